@@ -0,0 +1,85 @@
+// Counting replacements for the whole family of global allocation functions: plain, array,
+// nothrow and over-aligned new, and every matching (sized, nothrow, aligned) delete, so each
+// form of delete frees memory the matching new allocated. The counters live in the program
+// (climatechange.cpp).
+#include "allocation_counter.h"
+
+#include <cstdlib>
+#include <new>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+void count(size_t size) {
+    if (countAllocations) {
+        heapAllocations.fetch_add(1, memory_order_relaxed);
+        heapAllocatedBytes.fetch_add(size, memory_order_relaxed);
+    }
+}
+
+void* allocate(size_t size) {
+    count(size);
+    return malloc(size ? size : 1);
+}
+
+void* allocateAligned(size_t size, align_val_t alignment) {
+    count(size);
+#ifdef _WIN32
+    return _aligned_malloc(size ? size : 1, static_cast<size_t>(alignment));
+#else
+    void* p = nullptr;
+    return posix_memalign(&p, static_cast<size_t>(alignment), size ? size : 1) == 0 ? p : nullptr;
+#endif
+}
+
+void freeAligned(void* p) noexcept {
+#ifdef _WIN32
+    _aligned_free(p);
+#else
+    free(p);
+#endif
+}
+
+} // namespace
+
+void* operator new(size_t size) {
+    if (void* p = allocate(size)) return p;
+    throw bad_alloc();
+}
+void* operator new[](size_t size) {
+    if (void* p = allocate(size)) return p;
+    throw bad_alloc();
+}
+void* operator new(size_t size, const nothrow_t&) noexcept { return allocate(size); }
+void* operator new[](size_t size, const nothrow_t&) noexcept { return allocate(size); }
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+void operator delete(void* p, const nothrow_t&) noexcept { free(p); }
+void operator delete[](void* p, const nothrow_t&) noexcept { free(p); }
+
+void* operator new(size_t size, align_val_t alignment) {
+    if (void* p = allocateAligned(size, alignment)) return p;
+    throw bad_alloc();
+}
+void* operator new[](size_t size, align_val_t alignment) {
+    if (void* p = allocateAligned(size, alignment)) return p;
+    throw bad_alloc();
+}
+void* operator new(size_t size, align_val_t alignment, const nothrow_t&) noexcept {
+    return allocateAligned(size, alignment);
+}
+void* operator new[](size_t size, align_val_t alignment, const nothrow_t&) noexcept {
+    return allocateAligned(size, alignment);
+}
+void operator delete(void* p, align_val_t) noexcept { freeAligned(p); }
+void operator delete[](void* p, align_val_t) noexcept { freeAligned(p); }
+void operator delete(void* p, size_t, align_val_t) noexcept { freeAligned(p); }
+void operator delete[](void* p, size_t, align_val_t) noexcept { freeAligned(p); }
+void operator delete(void* p, align_val_t, const nothrow_t&) noexcept { freeAligned(p); }
+void operator delete[](void* p, align_val_t, const nothrow_t&) noexcept { freeAligned(p); }
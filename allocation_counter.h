@@ -0,0 +1,17 @@
+// Heap allocation counters behind the allocation columns of --stats and the benchmarks.
+//
+// allocation_counter.cpp replaces the global allocation functions with ones that count into
+// these while countAllocations is set. It is a translation unit of its own so the compiler never
+// inlines the replacements into code that allocates; builds that leave it out keep the library's
+// allocator and count nothing.
+#ifndef CLIMASCOPE_ALLOCATION_COUNTER_H
+#define CLIMASCOPE_ALLOCATION_COUNTER_H
+
+#include <atomic>
+#include <cstdint>
+
+extern bool countAllocations; // set once at startup, before any thread starts
+extern std::atomic<uint64_t> heapAllocations;
+extern std::atomic<uint64_t> heapAllocatedBytes;
+
+#endif
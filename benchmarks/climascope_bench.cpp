@@ -0,0 +1,261 @@
+// Microbenchmarks for the load, search and display paths, in the style of Google Benchmark:
+// every case runs a timed loop until it has taken at least --min-time seconds and reports the
+// time, heap allocations and allocated bytes per operation. Archives of 10^3 .. 10^6 synthetic
+// storms are generated once per size (not timed) from the reference typhoons.csv and shared by
+// all cases.
+//
+//   ./climascope_bench [--filter=<substring>] [--min-time=<seconds>] [--max-rows=<n>]
+#define CLIMASCOPE_NO_MAIN
+#include "../climatechange.cpp"
+#include "../tools/synthetic_archive.h"
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <memory>
+
+#ifndef CLIMASCOPE_REFERENCE_ARCHIVE
+#define CLIMASCOPE_REFERENCE_ARCHIVE "typhoons.csv"
+#endif
+
+// Output sink for everything the measured code prints
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+// Timing state handed to a benchmark body; "for (auto _ : state)" runs the measured loop
+class BenchmarkState {
+public:
+    BenchmarkState(size_t iterations, size_t rows) : iterations(iterations), rows(rows) {}
+
+    size_t iterationCount() const { return iterations; }
+    size_t range() const { return rows; }
+    void pauseTiming() { accumulate(); paused = true; }
+    void resumeTiming() { paused = false; startMeasure(); }
+
+    // Non-trivial like Google Benchmark's loop value, so an unused "_" raises no warning
+    struct Value {
+        Value() {}
+        ~Value() {}
+    };
+    struct Iterator {
+        BenchmarkState* state;
+        size_t remaining;
+        bool operator!=(const Iterator&) {
+            if (remaining != 0) return true;
+            state->accumulate();
+            state->paused = true;
+            return false;
+        }
+        void operator++() { --remaining; }
+        Value operator*() const { return Value(); }
+    };
+    Iterator begin() { paused = false; startMeasure(); return {this, iterations}; }
+    Iterator end() { return {this, 0}; }
+
+    double seconds = 0;
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+
+private:
+    void startMeasure() {
+        start = chrono::steady_clock::now();
+        startAllocations = heapAllocations.load();
+        startBytes = heapAllocatedBytes.load();
+    }
+    void accumulate() {
+        if (paused) return;
+        seconds += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        allocations += heapAllocations.load() - startAllocations;
+        bytes += heapAllocatedBytes.load() - startBytes;
+    }
+
+    size_t iterations;
+    size_t rows;
+    bool paused = true;
+    chrono::steady_clock::time_point start;
+    uint64_t startAllocations = 0;
+    uint64_t startBytes = 0;
+};
+
+// One synthetic archive: its CSV file plus the tables the search cases run on
+struct BenchArchive {
+    string csvPath;
+    vector<TyphoonTable> years;
+    TyphoonDataset dataset;
+    TyphoonTable all;
+};
+
+vector<string> archiveFiles;
+SyntheticProfile syntheticProfile;
+
+// Function to generate (once) and return the archive with the given number of storms
+BenchArchive& benchArchive(size_t rows) {
+    static map<size_t, unique_ptr<BenchArchive>> archives;
+    unique_ptr<BenchArchive>& archive = archives[rows];
+    if (!archive) {
+        archive.reset(new BenchArchive);
+        SyntheticArchiveOptions options;
+        options.rows = rows;
+        StringArena text;
+        vector<Typhoon> typhoons = makeSyntheticArchive(options, syntheticProfile, text);
+        archive->csvPath = "climascope_bench_" + to_string(rows) + ".csv";
+        writeArchiveCsv(archive->csvPath, typhoons);
+        archiveFiles.push_back(archive->csvPath);
+        archive->all = buildTable(vector<Typhoon>(typhoons));
+        archive->years = buildYearTables(move(typhoons));
+        for (const TyphoonTable& table : archive->years) archive->dataset.add(table);
+    }
+    return *archive;
+}
+
+// Function to feed the same menu answers to cin for every iteration of an interactive search
+void scriptInput(istringstream& input, const string& perIteration, size_t iterations, const string& prefix = "") {
+    string script = prefix;
+    script.reserve(prefix.size() + perIteration.size() * iterations);
+    for (size_t i = 0; i < iterations; ++i) script += perIteration;
+    input.str(script);
+    input.clear();
+    cin.rdbuf(input.rdbuf());
+    cin.clear();
+}
+
+// Function to benchmark an interactive search, answering "2" (Menu) to its follow-up prompt
+void runSearch(BenchmarkState& state, const string& answers, void (*search)(const TyphoonDataset&),
+               const string& prefix = "") {
+    BenchArchive& archive = benchArchive(state.range());
+    istringstream input;
+    streambuf* stdinBuffer = cin.rdbuf();
+    scriptInput(input, answers, state.iterationCount(), prefix);
+    for (auto _ : state) search(archive.dataset);
+    cin.rdbuf(stdinBuffer);
+}
+
+const size_t CACHED_CASE_BYTES = 64 << 20;
+
+struct BenchmarkCase {
+    string name;
+    function<void(BenchmarkState&)> body;
+};
+
+vector<BenchmarkCase> benchmarkCases() {
+    return {
+        {"LoadTyphoons", [](BenchmarkState& state) {
+            dataFilePath = benchArchive(state.range()).csvPath;
+            for (auto _ : state) {
+                StringArena text;
+                vector<Typhoon> year = loadTyphoons(2024, text);
+            }
+        }},
+        {"LoadArchiveTables", [](BenchmarkState& state) {
+            const string path = benchArchive(state.range()).csvPath;
+            for (auto _ : state) {
+                vector<Typhoon> all;
+                StringArena text;
+                loadTyphoonsFromFile(path, 0, all, text);
+                vector<TyphoonTable> years = buildYearTables(move(all));
+            }
+        }},
+        {"GetTyphoonsForMonth", [](BenchmarkState& state) {
+            const TyphoonTable& table = benchArchive(state.range()).all;
+            size_t found = 0;
+            int month = 0;
+            for (auto _ : state) {
+                found += getTyphoonsForMonth(table, 2024, month % 12 + 1).size();
+                ++month;
+            }
+            if (found == numeric_limits<size_t>::max()) cout << found;
+        }},
+        {"DisplayTyphoonsMonth", [](BenchmarkState& state) {
+            const TyphoonTable& table = benchArchive(state.range()).all;
+            const RowSpan rows = getTyphoonsForMonth(table, 2024, 9);
+            for (auto _ : state) displayTyphoons(table, rows);
+        }},
+        {"SearchTop3Strongest", [](BenchmarkState& state) { runSearch(state, "2\n", searchTop3Strongest); }},
+        {"SearchMostDamaging", [](BenchmarkState& state) { runSearch(state, "2\n", searchMostDamaging); }},
+        {"SearchAlphabetical", [](BenchmarkState& state) { runSearch(state, "2\n", searchAlphabetical); }},
+        {"SearchLongestStay", [](BenchmarkState& state) { runSearch(state, "2\n", searchLongestStay); }},
+        {"SearchLandfall", [](BenchmarkState& state) { runSearch(state, "2\n", searchLandfall); }},
+        {"SearchByPlace", [](BenchmarkState& state) { runSearch(state, "Albay\n2\n", searchByPlace, "\n"); }},
+        {"SearchPlacesHitInMonths", [](BenchmarkState& state) { runSearch(state, "8\n2\n", searchPlacesHitInMonths); }},
+        {"SearchTopK", [](BenchmarkState& state) { runSearch(state, "3 10\n2\n", searchTopK); }},
+        {"SearchByName", [](BenchmarkState& state) { runSearch(state, "Kristine 9\n2\n", searchByName, "\n"); }},
+        // Repeats answered from the result cache, which the other cases run without
+        {"SearchTop3StrongestCached", [](BenchmarkState& state) {
+            resultCache.setCapacity(CACHED_CASE_BYTES);
+            runSearch(state, "2\n", searchTop3Strongest);
+            resultCache.setCapacity(0);
+        }},
+        {"DisplayMonthCached", [](BenchmarkState& state) {
+            const TyphoonTable& table = benchArchive(state.range()).all;
+            resultCache.setCapacity(CACHED_CASE_BYTES);
+            for (auto _ : state) displayMonth(table, 2024, 9);
+            resultCache.setCapacity(0);
+        }},
+    };
+}
+
+int main(int argc, char* argv[]) {
+    string filter;
+    double minTime = 0.5;
+    size_t maxRows = 1000000;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg.compare(0, 9, "--filter=") == 0) {
+            filter = arg.substr(9);
+        } else if (arg.compare(0, 11, "--min-time=") == 0) {
+            minTime = atof(arg.c_str() + 11);
+        } else if (arg.compare(0, 11, "--max-rows=") == 0) {
+            maxRows = strtoull(arg.c_str() + 11, nullptr, 10);
+        } else {
+            cout << "Usage: " << argv[0] << " [--filter=<substring>] [--min-time=<seconds>] [--max-rows=<n>]" << endl;
+            return 1;
+        }
+    }
+
+    // Heap allocations are counted by allocation_counter.cpp, linked into this program
+    countAllocations = true;
+    if (!loadSyntheticProfile(CLIMASCOPE_REFERENCE_ARCHIVE, syntheticProfile)) return 1;
+    // Every iteration repeats the same search, so only the *Cached cases may use the result cache
+    resultCache.setCapacity(0);
+
+    // Results go to the real stdout; everything the measured code prints goes to the null sink
+    ostream results(cout.rdbuf());
+    NullBuffer nullBuffer;
+    cout.rdbuf(&nullBuffer);
+
+    results << left << setw(36) << "Benchmark" << right << setw(16) << "Time/op" << setw(14) << "Iterations"
+            << setw(14) << "Allocs/op" << setw(16) << "Bytes/op" << '\n'
+            << string(96, '-') << '\n';
+    for (const BenchmarkCase& bench : benchmarkCases()) {
+        if (!filter.empty() && bench.name.find(filter) == string::npos) continue;
+        for (size_t rows = 1000; rows <= maxRows; rows *= 10) {
+            // Grow the iteration count until one run lasts minTime, as Google Benchmark does
+            size_t iterations = 1;
+            BenchmarkState state(iterations, rows);
+            while (true) {
+                state = BenchmarkState(iterations, rows);
+                bench.body(state);
+                if (state.seconds >= minTime || iterations >= 1000000000) break;
+                const double perIteration = max(state.seconds / iterations, 1e-9);
+                const double wanted = minTime * 1.4 / perIteration;
+                iterations = static_cast<size_t>(min(wanted, iterations * 100.0)) + 1;
+            }
+            char timing[32];
+            const double ns = state.seconds * 1e9 / iterations;
+            if (ns >= 1e6) snprintf(timing, sizeof(timing), "%.2f ms", ns / 1e6);
+            else if (ns >= 1e3) snprintf(timing, sizeof(timing), "%.2f us", ns / 1e3);
+            else snprintf(timing, sizeof(timing), "%.1f ns", ns);
+            results << left << setw(36) << (bench.name + "/" + to_string(rows)) << right << setw(16) << timing
+                    << setw(14) << iterations << setw(14) << state.allocations / iterations
+                    << setw(16) << state.bytes / iterations << '\n';
+            results.flush();
+        }
+    }
+    consoleReport.flush();
+    cout.rdbuf(results.rdbuf());
+    for (const string& path : archiveFiles) remove(path.c_str());
+    return 0;
+}
@@ -0,0 +1,81 @@
+// Benchmark for the column kernels: compares the original scalar most-damaging loop with the
+// dispatched arg-max, and the scalar against the AVX2 filter kernels, on synthetic columns.
+//
+//   g++ -std=c++17 -O2 -pthread benchmarks/simd_kernels.cpp -o simd_kernels
+//   ./simd_kernels [rows]
+#define CLIMASCOPE_NO_MAIN
+#include "../climatechange.cpp"
+
+#include <chrono>
+#include <random>
+
+// Function to time fn over several runs and return the best run in nanoseconds per row
+template <typename Fn>
+double bestNsPerRow(size_t rows, Fn fn) {
+    double best = numeric_limits<double>::max();
+    for (int run = 0; run < 15; ++run) {
+        auto start = chrono::steady_clock::now();
+        fn();
+        auto stop = chrono::steady_clock::now();
+        best = min(best, chrono::duration<double, nano>(stop - start).count() / rows);
+    }
+    return best;
+}
+
+volatile size_t sink; // keeps results alive so the timed loops are not optimized away
+
+int main(int argc, char* argv[]) {
+    const size_t rows = argc > 1 ? strtoull(argv[1], nullptr, 10) : 1000000;
+    if (rows == 0) return 1;
+    mt19937_64 rng(2024);
+    lognormal_distribution<double> damagesDist(19.0, 2.5);
+    normal_distribution<double> windDist(95.0, 40.0);
+    uniform_int_distribution<int> crossingDist(0, 2);
+    vector<double> damages(rows);
+    vector<int32_t> wind(rows);
+    vector<uint8_t> crossing(rows);
+    for (size_t i = 0; i < rows; ++i) {
+        damages[i] = damagesDist(rng);
+        wind[i] = max(30, static_cast<int32_t>(windDist(rng)));
+        crossing[i] = static_cast<uint8_t>(crossingDist(rng));
+    }
+    vector<uint32_t> selected(rows);
+    const SimdLevel detected = detectSimdLevel();
+
+    cout << "Rows: " << rows << ", AVX2 " << (detected == SIMD_AVX2 ? "available" : "not available") << endl;
+    cout << left << setw(34) << "kernel" << right << setw(12) << "scalar" << setw(12) << "dispatched"
+         << setw(10) << "speed-up" << endl;
+    auto line = [&](const char* name, double scalar, double dispatched) {
+        cout << left << setw(34) << name << right << fixed << setprecision(3) << setw(9) << scalar << " ns"
+             << setw(9) << dispatched << " ns" << setw(9) << setprecision(1) << scalar / dispatched << "x" << endl;
+    };
+
+    // The loop searchMostDamaging ran before the kernels, against the dispatched arg-max
+    const double legacy = bestNsPerRow(rows, [&] {
+        size_t most = 0;
+        for (size_t i = 1; i < rows; ++i) {
+            if (damages[i] > damages[most]) most = i;
+        }
+        sink = most;
+    });
+    simdLevel = detected;
+    line("most damaging (arg-max damages)", legacy, bestNsPerRow(rows, [&] { sink = argMax(damages.data(), rows); }));
+
+    auto compare = [&](const char* name, auto kernel) {
+        simdLevel = SIMD_SCALAR;
+        const double scalar = bestNsPerRow(rows, kernel);
+        simdLevel = detected;
+        line(name, scalar, bestNsPerRow(rows, kernel));
+    };
+    compare("max wind (arg-max int32)", [&] { sink = argMax(wind.data(), rows); });
+    compare("filter wind > 150", [&] {
+        sink = selectRange(wind.data(), rows, 0, 151, numeric_limits<int32_t>::max(), selected.data(), 0);
+    });
+    compare("filter damages in [1e8, 1e10]", [&] {
+        sink = selectRange(damages.data(), rows, 0, 1e8, 1e10, selected.data(), 0);
+    });
+    compare("filter crossing = Land", [&] {
+        sink = selectEqual(crossing.data(), rows, 0, CROSSING_LAND, selected.data(), 0);
+    });
+    return 0;
+}
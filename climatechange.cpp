@@ -1,1750 +1,5801 @@
-#include <iostream>
-#include <fstream>
-#include <sstream>
-#include <vector>
-#include <string>
-#include <algorithm>
-#include <iomanip>
-#include <limits>
-#include <map>
-
-using namespace std;
-
-// Struct to hold typhoon data
-struct Typhoon {
-    string name;
-    string arrival; // Format: military time_MM/DD
-    string departure; // Format: military time_MM/DD
-    string month;
-    string interval;
-    string stormCrossing;
-    string timeOfLandfall;
-    string developed;
-    string pathType;
-    string levels;
-    int windSpeed;
-    int casualties;
-    double damages; // in Peso
-    string placesAffected;
-};
-
-vector<Typhoon> loadTyphoons(int year);
-vector<Typhoon> getTyphoonsForMonth(const vector<Typhoon>& typhoons, int month);
-void displayTyphoons(const vector<Typhoon>& typhoons);
-void displayResolutions(int year);
-void searchTop3Strongest(const vector<Typhoon>& typhoons2024, const vector<Typhoon>& typhoons2025);
-void searchMostDamaging(const vector<Typhoon>& typhoons2024, const vector<Typhoon>& typhoons2025);
-void searchAlphabetical(const vector<Typhoon>& typhoons2024, const vector<Typhoon>& typhoons2025);
-void searchLongestStay(const vector<Typhoon>& typhoons2024, const vector<Typhoon>& typhoons2025);
-void searchLandfall(const vector<Typhoon>& typhoons2024, const vector<Typhoon>& typhoons2025);
-
-// Function to convert month name to int
-int getMonthInt(const string& monthStr) {
-    static const map<string, int> monthMap = {
-        {"January", 1}, {"February", 2}, {"March", 3}, {"April", 4}, {"May", 5}, {"June", 6},
-        {"July", 7}, {"August", 8}, {"September", 9}, {"October", 10}, {"November", 11}, {"December", 12}
-    };
-    auto it = monthMap.find(monthStr);
-    return it != monthMap.end() ? it->second : 0;
-}
-
-// Function to parse month from arrival/departure date (MM/DD), with error handling
-int getMonth(const string& date) {
-    size_t pos = date.find('_');
-    if (pos != string::npos) {
-        string mmdd = date.substr(pos + 1);
-        size_t slash = mmdd.find('/');
-        if (slash != string::npos) {
-            try {
-                int month = stoi(mmdd.substr(0, slash));
-                if (month >= 1 && month <= 12) return month;
-            } catch (...) {
-                return 0; // Invalid
-            }
-        }
-    }
-    return 0; // Invalid
-}
-
-// Function to load typhoons from hardcoded data
-vector<Typhoon> loadTyphoons(int year) {
-    vector<Typhoon> typhoons;
-    if (year == 2024) {
-        // Aghon
-        Typhoon t1;
-        t1.name = "Aghon";
-        t1.arrival = "2000_05/23";
-        t1.departure = "1200_05/29";
-        t1.month = "May";
-        t1.interval = "6";
-        t1.stormCrossing = "Land";
-        t1.timeOfLandfall = "5/24/2024 23:20:00";
-        t1.developed = "WITHIN THE PAR";
-        t1.pathType = "East to Northeast";
-        t1.levels = "Tropical Depression";
-        t1.windSpeed = 140;
-        t1.casualties = 6;
-        t1.damages = 1030000000.0;
-        t1.placesAffected = "Region III | Aurora | Zambales | Pampanga | Bulacan | Nueva Ecija | Tarlac | Region V | Camarines Sur | Camarines Norte | Albay | Sorsogon | Masbate | Catanduanes | Region VI | Iloilo | Guimaras | Capiz | Aklan | Antique | Negros Occidental | Region VII | Cebu | Bohol | Negros Oriental | Siquijor | Region VIII | Northern Samar | Eastern Samar | Samar | Leyte | Southern Leyte | Biliran";
-        typhoons.push_back(t1);
-
-        // Butchoy
-        Typhoon t2;
-        t2.name = "Butchoy";
-        t2.arrival = "0800_07/19";
-        t2.departure = "0700_07/20";
-        t2.month = "July";
-        t2.interval = "1";
-        t2.stormCrossing = "Land";
-        t2.timeOfLandfall = "2024-07-18 10:00";
-        t2.developed = "WITHIN THE PAR";
-        t2.pathType = "Southwestward";
-        t2.levels = "Tropical Depression";
-        t2.windSpeed = 55;
-        t2.casualties = 0;
-        t2.damages = 0.0;
-        t2.placesAffected = "Region III | Aurora | Zambales | Pampanga | Bulacan | Nueva Ecija | Tarlac | Region IV-A | Quezon | Rizal | Cavite | Laguna | Batangas | Region IV-B | Palawan | Occidental Mindoro | Oriental Mindoro | Romblon | Marinduque | Region V | Camarines Sur | Camarines Norte | Albay | Sorsogon | Masbate | Catanduanes | Region VI | Iloilo | Guimaras | Capiz | Aklan | Antique | Negros Occidental";
-        typhoons.push_back(t2);
-
-        // Carina
-        Typhoon t3;
-        t3.name = "Carina";
-        t3.arrival = "2000_07/19";
-        t3.departure = "0800_07/24";
-        t3.month = "July";
-        t3.interval = "5";
-        t3.stormCrossing = "Water";
-        t3.timeOfLandfall = "2024-07-19 4:00";
-        t3.developed = "WITHIN THE PAR";
-        t3.pathType = "Northwestard";
-        t3.levels = "Super Typhoon";
-        t3.windSpeed = 185;
-        t3.casualties = 48;
-        t3.damages = 10400000000.0;
-        t3.placesAffected = "Region II | Isabela | Cagayan | Quirino | Nueva Vizcaya | Region III | Aurora | Zambales | Pampanga | Bulacan | Nueva Ecija | Tarlac | Region IV-A | Quezon | Rizal | Cavite | Laguna | Batangas | Region IV-B | Palawan | Occidental Mindoro | Oriental Mindoro | Romblon | Marinduque | Region V | Camarines Sur | Camarines Norte | Albay | Sorsogon | Masbate | Catanduanes | Region VI | Iloilo | Guimaras | Capiz | Aklan | Antique | Negros Occidental | Region VII | Cebu | Bohol | Negros Oriental | Siquijor | Region VIII | Northern Samar | Eastern Samar | Samar | Leyte | Southern Leyte | Biliran";
-        typhoons.push_back(t3);
-
-        // Dindo
-        Typhoon t4;
-        t4.name = "Dindo";
-        t4.arrival = "0800_08/18";
-        t4.departure = "0700_08/19";
-        t4.month = "August";
-        t4.interval = "1";
-        t4.stormCrossing = "Water";
-        t4.timeOfLandfall = "2024-08-18 2:00";
-        t4.developed = "WITHIN THE PAR";
-        t4.pathType = "Westward";
-        t4.levels = "Tropical Storm";
-        t4.windSpeed = 65;
-        t4.casualties = 0;
-        t4.damages = 0.0;
-        t4.placesAffected = "Region V | Camarines Sur | Camarines Norte | Albay | Sorsogon | Masbate | Catanduanes | Region VI | Iloilo | Guimaras | Capiz | Aklan | Antique | Negros Occidental | Region VII | Cebu | Bohol | Negros Oriental | Siquijor";
-        typhoons.push_back(t4);
-
-        // Enteng
-        Typhoon t5;
-        t5.name = "Enteng";
-        t5.arrival = "2300_09/01";
-        t5.departure = "2000_09/04";
-        t5.month = "September";
-        t5.interval = "3";
-        t5.stormCrossing = "Land";
-        t5.timeOfLandfall = "2024-09-02 14:00";
-        t5.developed = "OUTSIDE THE PAR";
-        t5.pathType = "Northwestward";
-        t5.levels = "Tropical Storm";
-        t5.windSpeed = 88;
-        t5.casualties = 21;
-        t5.damages = 2600000000.0;
-                t5.placesAffected = "Region III | Aurora | Zambales | Pampanga | Bulacan | Nueva Ecija | Tarlac | Region IV-A | Quezon | Rizal | Cavite | Laguna | Batangas | Region IV-B | Palawan | Occidental Mindoro | Oriental Mindoro | Romblon | Marinduque | Region V | Camarines Sur | Camarines Norte | Albay | Sorsogon | Masbate | Catanduanes | Region VI | Iloilo | Guimaras | Capiz | Aklan | Antique | Negros Occidental | Region VII | Cebu | Bohol | Negros Oriental | Siquijor | Region VIII | Northern Samar | Eastern Samar | Samar | Leyte | Southern Leyte | Biliran";
-        typhoons.push_back(t5);
-
-        // Ferdie
-        Typhoon t6;
-        t6.name = "Ferdie";
-        t6.arrival = "1600_09/13";
-        t6.departure = "0200_09/14";
-        t6.month = "September";
-        t6.interval = "1";
-        t6.stormCrossing = "Water";
-        t6.timeOfLandfall = "2024-09-13 10:00";
-        t6.developed = "OUTSIDE THE PAR";
-        t6.pathType = "Northwestward-Northward";
-        t6.levels = "Tropical Storm";
-        t6.windSpeed = 85;
-        t6.casualties = 20;
-        t6.damages = 1900000000.0;
-        t6.placesAffected = "Region IV-B | Occidental Mindoro | Oriental Mindoro | Palawan | Romblon | Region V | Camarines Sur | Albay | Sorsogon | Masbate | Region VI | Negros Occidental | Antique | Capiz | Aklan | Iloilo | Guimaras | Region VII | Cebu | Bohol | Negros Oriental | Region IX | Zamboanga del Sur | Zamboanga del Norte | Zamboanga Sibugay | BARMM | Lanao del Sur | Maguindanao del Norte | Maguindanao del Sur | Region X | Misamis Oriental | Misamis Occidental | Lanao del Norte | Region XI | Davao del Sur | Davao del Norte";
-        typhoons.push_back(t6);
-
-        // Gener
-        Typhoon t7;
-        t7.name = "Gener";
-        t7.arrival = "0800_09/16";
-        t7.departure = "0200_09/18";
-        t7.month = "September";
-        t7.interval = "2";
-        t7.stormCrossing = "Land";
-        t7.timeOfLandfall = "2024-09-17 0:00";
-        t7.developed = "WITHIN THE PAR";
-        t7.pathType = "West-Northwestward";
-        t7.levels = "Tropical Depresion";
-        t7.windSpeed = 55;
-        t7.casualties = 20;
-        t7.damages = 1121000000.0;
-        t7.placesAffected = "Region I | Ilocos Sur | Ilocos Norte | La Union | Pangasinan | Region II | Isabela | Cagayan | Quirino | Nueva Vizcaya | Region III | Zambales | Bataan | Tarlac | Nueva Ecija | Pampanga | Bulacan | Aurora | CAR | Ifugao | Mountain Province | Kalinga | Apayao | Benguet";
-        typhoons.push_back(t7);
-
-        // Helen
-        Typhoon t8;
-        t8.name = "Helen";
-        t8.arrival = "1830_09/17";
-        t8.departure = "1700_09/18";
-        t8.month = "September";
-        t8.interval = "1";
-        t8.stormCrossing = "Water";
-        t8.timeOfLandfall = "2024-09-17 18:30";
-        t8.developed = "OUTSIDE THE PAR";
-        t8.pathType = "West-Northwestward";
-        t8.levels = "Tropical Storm";
-        t8.windSpeed = 85;
-        t8.casualties = 20;
-        t8.damages = 1121000000.0;
-        t8.placesAffected = "Region IV-A | Rizal | Quezon | Laguna | Cavite | Batangas | Region IV-B | Occidental Mindoro | Oriental Mindoro | Palawan | Romblon | Region V | Camarines Sur | Albay | Sorsogon | Masbate | Catanduanes | Region VI | Negros Occidental | Antique | Iloilo | Aklan | Capiz | Guimaras | Region VII | Cebu | Bohol | Negros Oriental | Siquijor | Region IX | Zamboanga del Sur | Zamboanga del Norte | Zamboanga Sibugay | BARMM | Lanao del Sur | Maguindanao del Norte | Maguindanao del Sur";
-        typhoons.push_back(t8);
-
-        // Igme
-        Typhoon t9;
-        t9.name = "Igme";
-        t9.arrival = "0000_09/20";
-        t9.departure = "0400_09/21";
-        t9.month = "September";
-        t9.interval = "1";
-        t9.stormCrossing = "Water";
-        t9.timeOfLandfall = "2024-09-20 5:00";
-        t9.developed = "OUTSIDE THE PAR";
-        t9.pathType = "West-Southwestward";
-        t9.levels = "Tropical Depression";
-        t9.windSpeed = 55;
-        t9.casualties = 48;
-        t9.damages = 4100000000.0;
-        t9.placesAffected = "Region IV-A | Rizal | Quezon | Laguna | Cavite | Batangas | Region IV-B | Occidental Mindoro | Oriental Mindoro | Palawan | Romblon | Region V | Camarines Sur | Albay | Sorsogon | Masbate | Catanduanes | Region VI | Negros Occidental | Antique | Iloilo | Aklan | Capiz | Guimaras | Region VII | Cebu | Bohol | Negros Oriental | Siquijor | Region IX | Zamboanga del Sur | Zamboanga del Norte | Zamboanga Sibugay | BARMM | Lanao del Sur | Maguindanao del Norte | Maguindanao del Sur";
-        typhoons.push_back(t9);
-
-        // Julian
-        Typhoon t10;
-        t10.name = "Julian";
-        t10.arrival = "0800_10/01";
-        t10.departure = "0500_10/04";
-        t10.month = "October";
-        t10.interval = "3";
-        t10.stormCrossing = "Water";
-        t10.timeOfLandfall = "2024-10-24 12:30";
-        t10.developed = "OUTSIDE THE PAR";
-        t10.pathType = "West-Northwestward";
-        t10.levels = "Super Typhoon";
-        t10.windSpeed = 195;
-        t10.casualties = 5;
-        t10.damages = 1570000000.0;
-        t10.placesAffected = "Region I | Ilocos Sur | Ilocos Norte | La Union | Pangasinan | Region II | Isabela | Cagayan | Quirino | Nueva Vizcaya | Region III | Zambales | Bataan | Tarlac | Nueva Ecija | Pampanga | Bulacan | Aurora | CAR | Ifugao | Mountain Province | Kalinga | Apayao | Benguet";
-        typhoons.push_back(t10);
-
-        // Kristine
-        Typhoon t11;
-        t11.name = "Kristine";
-        t11.arrival = "0000_10/21";
-        t11.departure = "0300_10/25";
-        t11.month = "October";
-        t11.interval = "4";
-        t11.stormCrossing = "Land";
-        t11.timeOfLandfall = "2024-10-26 19:30";
-        t11.developed = "WITHIN THE PAR";
-        t11.pathType = "West-Northwestward";
-        t11.levels = "Severe Typhoon Storm";
-        t11.windSpeed = 110;
-        t11.casualties = 137;
-        t11.damages = 7900000.0;
-        t11.placesAffected = "Region V | Camarines Sur | Camarines Norte | Albay | Sorsogon | Masbate | Catanduanes | Region II | Cagayan | Isabela | Apayao | Kalinga | Region I | Ilocos Norte | Ilocos Sur | La Union | Pangasinan | CAR | Benguet | Ifugao | Mountain Province | Abra | Region III | Aurora | Zambales | Pampanga | Bulacan | Nueva Ecija | Tarlac | Region IV-A | Quezon | Rizal | Cavite | Laguna | Batangas | Region IV-B | Palawan | Occidental Mindoro | Oriental Mindoro | Romblon | Marinduque";
-        typhoons.push_back(t11);
-
-        // Leon
-        Typhoon t12;
-        t12.name = "Leon";
-        t12.arrival = "1200_10/26";
-        t12.departure = "0300_10/31";
-        t12.month = "October";
-        t12.interval = "5";
-        t12.stormCrossing = "Water";
-        t12.timeOfLandfall = "2024-11-06 22:00";
-        t12.developed = "OUTSIDE THE PAR";
-        t12.pathType = "West-Northwestward";
-        t12.levels = "Super Typhoon";
-        t12.windSpeed = 185;
-        t12.casualties = 159;
-        t12.damages = 996000000.0;
-                t12.placesAffected = "Region I | Ilocos Sur | Ilocos Norte | La Union | Pangasinan | Region II | Isabela | Cagayan | Quirino | Nueva Vizcaya | Region III | Zambales | Bataan | Tarlac | Nueva Ecija | Pampanga | Bulacan | Aurora | CAR | Ifugao | Mountain Province | Kalinga | Apayao | Benguet | Region IV-A | Quezon | Rizal | Cavite | Laguna | Batangas | Region IV-B | Palawan | Occidental Mindoro | Oriental Mindoro | Romblon | Marinduque | Region IX | Zamboanga del Sur | Zamboanga del Norte | Zamboanga Sibugay | BARMM | Lanao";
-        typhoons.push_back(t12);
-
-        // Marce
-        Typhoon t13;
-        t13.name = "Marce";
-        t13.arrival = "1800_11/04";
-        t13.departure = "1600_11/08";
-        t13.month = "November";
-        t13.interval = "4";
-        t13.stormCrossing = "Land";
-        t13.timeOfLandfall = "2024-11-09 20:00";
-        t13.developed = "WITHIN THE PAR";
-        t13.pathType = "West - Northwestward";
-        t13.levels = "Typhoon";
-        t13.windSpeed = 120;
-        t13.casualties = 20;
-        t13.damages = 1900000000.0;
-        t13.placesAffected = "Region II | Cagayan | Isabela | Quirino | Nueva Vizcaya | Region III | Aurora | Zambales | Pampanga | Bulacan | Nueva Ecija | Tarlac | Region IV-A | Quezon | Rizal | Cavite | Laguna | Batangas | Region IV-B | Palawan | Occidental Mindoro | Oriental Mindoro | Romblon | Marinduque | Region V | Camarines Sur | Camarines Norte | Albay | Sorsogon | Masbate | Catanduanes | Region VI | Iloilo | Guimaras | Capiz | Aklan | Antique | Negros Occidental | Region VII | Cebu | Bohol | Negros Oriental | Siquijor | Region VIII | Northern Samar | Eastern Samar | Samar | Leyte | Southern Leyte | Biliran";
-        typhoons.push_back(t13);
-
-        // Nika
-        Typhoon t14;
-        t14.name = "Nika";
-        t14.arrival = "1800_11/08";
-        t14.departure = "1400_11/12";
-        t14.month = "November";
-        t14.interval = "4";
-        t14.stormCrossing = "Land";
-        t14.timeOfLandfall = "2024-11-12 14:00";
-        t14.developed = "WITHIN THE PAR";
-        t14.pathType = "West - Northwestward";
-        t14.levels = "Typhoon";
-        t14.windSpeed = 130;
-        t14.casualties = 20;
-        t14.damages = 1121000000.0;
-        t14.placesAffected = "Region II | Cagayan | Isabela | Apayao | Kalinga | Region I | Ilocos Norte | Ilocos Sur | La Union | Pangasinan | CAR | Benguet | Ifugao | Mountain Province | Region III | Aurora | Nueva Vizcaya | Quirino";
-        typhoons.push_back(t14);
-
-        // Ofel
-        Typhoon t15;
-        t15.name = "Ofel";
-        t15.arrival = "1800_11/11";
-        t15.departure = "1200_11/15";
-        t15.month = "November";
-        t15.interval = "4";
-        t15.stormCrossing = "Land";
-        t15.timeOfLandfall = "2024-11-17 16:00";
-        t15.developed = "WITHIN THE PAR";
-        t15.pathType = "Westward - Northwestward";
-        t15.levels = "Super Typhoon";
-        t15.windSpeed = 185;
-        t15.casualties = 48;
-        t15.damages = 10400000000.0;
-        t15.placesAffected = "Region II | Cagayan | Isabela | Apayao | Kalinga | Region I | Ilocos Norte | Ilocos Sur | La Union | Pangasinan | CAR | Benguet | Ifugao | Mountain Province | Abra | Region III | Aurora | Nueva Vizcaya | Quirino";
-        typhoons.push_back(t15);
-
-        // Pepito Manaloto
-        Typhoon t16;
-        t16.name = "Pepito Manaloto";
-        t16.arrival = "1200_11/16";
-        t16.departure = "0800_11/18";
-        t16.month = "November";
-        t16.interval = "2";
-        t16.stormCrossing = "Land";
-        t16.timeOfLandfall = "None";
-        t16.developed = "WITHIN THE PAR";
-        t16.pathType = "West - Northwestward";
-        t16.levels = "Typhoon";
-        t16.windSpeed = 150;
-        t16.casualties = 20;
-        t16.damages = 1900000000.0;
-        t16.placesAffected = "Region V | Catanduanes | Camarines Sur | Region III | Aurora | Isabela | Nueva Ecija | CAR | Benguet | Ifugao | Mountain Province";
-        typhoons.push_back(t16);
-
-        // Querubin
-        Typhoon t17;
-        t17.name = "Querubin";
-        t17.arrival = "0000_12/24";
-        t17.departure = "0000_12/25";
-        t17.month = "December";
-        t17.interval = "1";
-        t17.stormCrossing = "Water";
-        t17.timeOfLandfall = "None";
-        t17.developed = "OUTSIDE THE PAR";
-        t17.pathType = "East - Northwestward";
-        t17.levels = "Tropical Depression";
-        t17.windSpeed = 55;
-        t17.casualties = 0;
-        t17.damages = 0.0;
-        t17.placesAffected = "Region V | Albay | Sorsogon | Camarines Sur | Region VIII | Leyte | Southern Leyte";
-        typhoons.push_back(t17);
-    } 
-    else if (year == 2025) {
-        // Auring
-        Typhoon t1;
-        t1.name = "Auring";
-        t1.arrival = "1520_07/12";
-        t1.departure = "0000_07/13";
-        t1.month = "July";
-        t1.interval = "1";
-        t1.stormCrossing = "Water";
-        t1.timeOfLandfall = "None";
-        t1.developed = "Within the PAR";
-        t1.pathType = "North-Northwest";
-        t1.levels = "Tropical Depression";
-        t1.windSpeed = 140;
-        t1.casualties = 3;
-                t1.damages = 50000.0;
-        t1.placesAffected = "Region II | Cagayan Valley | Batanes | Babuyan Islands | CAR | Cordillera Administrative Region | Region I | Ilocos Region";
-        typhoons.push_back(t1);
-
-        // Bising
-        Typhoon t2;
-        t2.name = "Bising";
-        t2.arrival = "1100_07/04";
-        t2.departure = "0500_07/07";
-        t2.month = "July";
-        t2.interval = "3";
-        t2.stormCrossing = "Water";
-        t2.timeOfLandfall = "None";
-        t2.developed = "Within the PAR";
-        t2.pathType = "North-Northeastward";
-        t2.levels = "Typhoon";
-        t2.windSpeed = 140;
-        t2.casualties = 3;
-        t2.damages = 12400000.0;
-        t2.placesAffected = "Region I | Ilocos Region | Ilocos Norte | Ilocos Sur | La Union | Pangasinan | CAR | Cordillera Administrative Region | Apayao | Kalinga | Mountain Province | Ifugao | Benguet | Region II | Cagayan Valley | Cagayan | Isabela | Nueva Vizcaya | Quirino | Region III | Central Luzon | Bataan | Zambales | Aurora | Northern Nueva Ecija";
-        typhoons.push_back(t2);
-
-        // Crisig
-        Typhoon t3;
-        t3.name = "Crisig";
-        t3.arrival = "0800_07/16";
-        t3.departure = "1100_07/19";
-        t3.month = "July";
-        t3.interval = "3";
-        t3.stormCrossing = "Land";
-        t3.timeOfLandfall = "2025-07-18 8:00";
-        t3.developed = "Within the PAR";
-        t3.pathType = "West-Northwestward";
-        t3.levels = "Tropical Storm";
-        t3.windSpeed = 110;
-        t3.casualties = 40;
-        t3.damages = 19660000000.0;
-        t3.placesAffected = "Region II | Cagayan Valley | Cagayan | Isabela | Nueva Vizcaya | Quirino | Region I | Ilocos Region | Ilocos Norte | Ilocos Sur | La Union | Pangasinan | CAR | Cordillera Administrative Region | Apayao | Kalinga | Mountain Province | Ifugao | Benguet | Region III | Central Luzon | Aurora | Northern Nueva Ecija | Region V | Bicol Region | Camarines Norte | Region IV-A | CALABARZON | Northern Quezon | Polillo Islands | MIMAROPA | Mindoro | Marinduque | Romblon | Palawan | Occidental Mindoro | Oriental Mindoro | NCR | Metro Manila | Region VI | Western Visayas | Antique | Aklan | Iloilo";
-        typhoons.push_back(t3);
-
-        // Dante
-        Typhoon t4;
-        t4.name = "Dante";
-        t4.arrival = "0500_07/22";
-        t4.departure = "0300_07/24";
-        t4.month = "July";
-        t4.interval = "2";
-        t4.stormCrossing = "Water";
-        t4.timeOfLandfall = "None";
-        t4.developed = "Within the PAR";
-        t4.pathType = "West-Northwestward";
-        t4.levels = "Tropical Depression";
-        t4.windSpeed = 90;
-        t4.casualties = 10;
-        t4.damages = 196700000000.0;
-        t4.placesAffected = "Region I | Ilocos Region | Ilocos Norte | Ilocos Sur | La Union | Pangasinan | CAR | Cordillera Administrative Region | Apayao | Kalinga | Mountain Province | Ifugao | Benguet | Region II | Cagayan Valley | Cagayan | Isabela | Nueva Vizcaya | Quirino | Region III | Central Luzon | Bataan | Zambales | Aurora | Northern Nueva Ecija | Region IV-A | CALABARZON | Northern Quezon | Polillo Islands | Region IV-B | MIMAROPA | Occidental Mindoro | Oriental Mindoro | Marinduque | Romblon | Palawan | Region V | Bicol Region | Albay | Camarines Norte | Camarines Sur | NCR | Metro Manila | Region VI | Western Visayas | Antique | Aklan | Iloilo | Region VII | Central Visayas | Cebu | Bohol | Region IX | Zamboanga Peninsula | Zamboanga del Norte | Zamboanga del Sur | BARMM | Basilan | Sulu | Tawi-Tawi | Region XIII / Caraga | Surigao del Norte | Surigao del Sur | Agusan del Norte";
-        typhoons.push_back(t4);
-
-        // Emong
-        Typhoon t5;
-        t5.name = "Emong";
-        t5.arrival = "0300_07/23";
-        t5.departure = "0500_07/26";
-        t5.month = "July";
-        t5.interval = "3";
-        t5.stormCrossing = "Land";
-        t5.timeOfLandfall = "2025-07-24 10:40";
-        t5.developed = "Within the PAR";
-        t5.pathType = "West-Southwestward";
-        t5.levels = "Typhoon";
-        t5.windSpeed = 120;
-        t5.casualties = 40;
-        t5.damages = 20000000000.0;
-        t5.placesAffected = "Region I | Ilocos Region | Ilocos Norte | Ilocos Sur | La Union | Pangasinan | CAR | Cordillera Administrative Region | Apayao | Kalinga | Mountain Province | Ifugao | Benguet | Region II | Cagayan Valley | Cagayan | Isabela | Nueva Vizcaya | Quirino | Region III | Central Luzon | Bataan | Zambales | Aurora | Northern Nueva Ecija | Region IV-A | CALABARZON | Northern Quezon | Polillo Islands | Region IV-B | MIMAROPA | Occidental Mindoro | Oriental Mindoro | Marinduque | Romblon | Palawan | Region V | Bicol Region | Albay | Camarines Norte | Camarines Sur | NCR | Metro Manila | Region VI | Western Visayas | Antique | Aklan | Iloilo | Region VII | Central Visayas | Cebu | Bohol | Region IX | Zamboanga Peninsula | Zamboanga del Norte | Zamboanga del Sur | BARMM | Basilan | Sulu | Tawi-Tawi | Region XIII / Caraga | Surigao del Norte | Surigao del Sur | Agusan del Norte";
-        typhoons.push_back(t5);
-
-        // Fabian
-        Typhoon t6;
-        t6.name = "Fabian";
-        t6.arrival = "1200_08/07";
-        t6.departure = "1600_08/13";
-        t6.month = "August";
-        t6.interval = "1";
-        t6.stormCrossing = "Water";
-        t6.timeOfLandfall = "";
-        t6.developed = "Within the PAR";
-        t6.pathType = "West-Northwestward";
-        t6.levels = "Tropical Depression";
-        t6.windSpeed = 45;
-        t6.casualties = 40;
-        t6.damages = 20000000000.0;
-                t6.placesAffected = "Region I | Ilocos Region | Ilocos Norte | Ilocos Sur | La Union | Pangasinan | CAR | Cordillera Administrative Region | Apayao | Kalinga | Mountain Province | Ifugao | Benguet | Region II | Cagayan Valley | Cagayan | Isabela | Nueva Vizcaya | Quirino | Region III | Central Luzon | Bataan | Zambales | Aurora | Northern Nueva Ecija | Region IV-A | CALABARZON | Northern Quezon | Polillo Islands | Region IV-B | MIMAROPA | Occidental Mindoro | Oriental Mindoro | Marinduque | Romblon | Palawan | Region V | Bicol Region | Albay | Camarines Norte | Camarines Sur | NCR | Metro Manila | Region VI | Western Visayas | Antique | Aklan | Iloilo | Region VII | Central Visayas | Cebu | Bohol | Region IX | Zamboanga Peninsula | Zamboanga del Norte | Zamboanga del Sur | BARMM | Basilan | Sulu | Tawi-Tawi | Region XIII / Caraga | Surigao del Norte | Surigao del Sur | Agusan del Norte";
-        typhoons.push_back(t6);
-
-        // Gorio
-        Typhoon t7;
-        t7.name = "Gorio";
-        t7.arrival = "1120_08/10";
-        t7.departure = "0200_08/19";
-        t7.month = "August";
-        t7.interval = "3";
-        t7.stormCrossing = "Water";
-        t7.timeOfLandfall = "None";
-        t7.developed = "Outside the PAR";
-        t7.pathType = "West to West-Northwest";
-        t7.levels = "Typhoon";
-        t7.windSpeed = 155;
-        t7.casualties = 0;
-        t7.damages = 45000.0;
-        t7.placesAffected = "Region II | Cagayan Valley | Batanes | Babuyan Islands";
-        typhoons.push_back(t7);
-
-        // Huaning
-        Typhoon t8;
-        t8.name = "Huaning";
-        t8.arrival = "0200_08/17";
-        t8.departure = "0600_08/23";
-        t8.month = "August";
-        t8.interval = "2";
-        t8.stormCrossing = "Water";
-        t8.timeOfLandfall = "None";
-        t8.developed = "Within the PAR";
-        t8.pathType = "Northwest to Northeast";
-        t8.levels = "Tropical Depression";
-        t8.windSpeed = 70;
-        t8.casualties = 0;
-        t8.damages = 0.0;
-        t8.placesAffected = "No significant areas affected (remained offshore)";
-        typhoons.push_back(t8);
-
-        // Isang
-        Typhoon t9;
-        t9.name = "Isang";
-        t9.arrival = "1000_08/22";
-        t9.departure = "1800_08/30";
-        t9.month = "August";
-        t9.interval = "1";
-        t9.stormCrossing = "Land";
-        t9.timeOfLandfall = "10:00_08/22";
-        t9.developed = "Within the PAR";
-        t9.pathType = "Northwest to West";
-        t9.levels = "Tropical Storm";
-        t9.windSpeed = 90;
-        t9.casualties = 0;
-        t9.damages = 0.0;
-        t9.placesAffected = "Region II | Cagayan Valley | Cagayan | Isabela | Nueva Vizcaya | Quirino | Region I | Ilocos Region | Ilocos Norte | Ilocos Sur | La Union | Pangasinan | CAR | Cordillera Administrative Region | Apayao | Kalinga | Mountain Province | Ifugao | Benguet | Region III | Central Luzon | Aurora | Northern Nueva Ecija | Region V | Bicol Region | Camarines Norte | Region IV-A | CALABARZON | Northern Quezon | Polillo Islands | MIMAROPA | Mindoro | Marinduque | Romblon | Palawan | Occidental Mindoro | Oriental Mindoro | Marinduque | Romblon | NCR | Metro Manila | Region VI | Western Visayas | Antique | Aklan | Iloilo";
-        typhoons.push_back(t9);
-
-        // Jacinto
-        Typhoon t10;
-        t10.name = "Jacinto";
-        t10.arrival = "0000_08/28";
-        t10.departure = "0400_09/03";
-        t10.month = "August";
-        t10.interval = "2";
-        t10.stormCrossing = "Water";
-        t10.timeOfLandfall = "None";
-        t10.developed = "WITHIN THE PAR";
-        t10.pathType = "West to Northwest";
-        t10.levels = "Tropical Depression";
-        t10.windSpeed = 45;
-        t10.casualties = 0;
-        t10.damages = 710000.0;
-              t10.placesAffected = "Region I | Ilocos Region | Ilocos Norte | Ilocos Sur | La Union | Pangasinan | CAR | Cordillera Administrative Region | Apayao | Kalinga | Mountain Province | Ifugao | Benguet | Region II | Cagayan Valley | Cagayan | Isabela | Nueva Vizcaya | Quirino | Region III | Central Luzon | Bataan | Zambales | Aurora | Northern Nueva Ecija | Region IV-A | CALABARZON | Northern Quezon | Polillo Islands | Region IV-B | MIMAROPA | Occidental Mindoro | Oriental Mindoro | Marinduque | Romblon | Palawan | Region V | Bicol Region | Albay | Camarines Norte | Camarines Sur | NCR | Metro Manila | Region VI | Western Visayas | Antique | Aklan | Iloilo | Region VII | Central Visayas | Cebu | Bohol | Region IX | Zamboanga Peninsula | Zamboanga del Norte | Zamboanga del Sur | BARMM | Basilan | Sulu | Tawi-Tawi | Region XIII / Caraga | Surigao del Norte | Surigao del Sur | Agusan del Norte";
-        typhoons.push_back(t10);
-
-        // Kiko
-        Typhoon t11;
-        t11.name = "Kiko";
-        t11.arrival = "1200_09/02";
-        t11.departure = "0000_09/06";
-        t11.month = "September";
-        t11.interval = "1";
-        t11.stormCrossing = "Water";
-        t11.timeOfLandfall = "None";
-        t11.developed = "WITHIN THE PAR";
-        t11.pathType = "East to Northeast";
-        t11.levels = "Tropical Storm";
-        t11.windSpeed = 85;
-        t11.casualties = 0;
-        t11.damages = 0.0;
-        t11.placesAffected = "Region II | Cagayan Valley | Isabela | Nueva Vizcaya | Quirino | Region III | Central Luzon | Nueva Ecija | Pampanga | Region VI | Western Visayas | Antique | NCR | Metro Manila";
-        typhoons.push_back(t11);
-
-        // Lannie
-        Typhoon t12;
-        t12.name = "Lannie";
-        t12.arrival = "1800_09/05";
-        t12.departure = "2300_09/17";
-        t12.month = "September";
-        t12.interval = "1";
-        t12.stormCrossing = "Water";
-        t12.timeOfLandfall = "None";
-        t12.developed = "WITHIN THE PAR";
-        t12.pathType = "West to Northwestward";
-        t12.levels = "Tropical Depression";
-        t12.windSpeed = 55;
-        t12.casualties = 0;
-        t12.damages = 0.0;
-        t12.placesAffected = "Region I | Ilocos Region | Sinait | Ilocos Sur | CAR | Cordillera Administrative Region | Region II | Cagayan Valley | Bayombong | Nueva Ecija | Region III | Zambales | NCR | Metro Manila | Region IV-A / IV-B | CALABARZON | MIMAROPA";
-        typhoons.push_back(t12);
-
-        // Mirasol
-        Typhoon t13;
-        t13.name = "Mirasol";
-        t13.arrival = "0000_09/16";
-        t13.departure = "0300_09/25";
-        t13.month = "September";
-        t13.interval = "1";
-        t13.stormCrossing = "Land";
-        t13.timeOfLandfall = "19:20_09/16";
-        t13.developed = "WITHIN THE PAR";
-        t13.pathType = "East to Northwest";
-        t13.levels = "Tropical Depression";
-        t13.windSpeed = 55;
-        t13.casualties = 1;
-        t13.damages = 0.0;
-        t13.placesAffected = "Region I | Baler, Aurora | Casiguran, Aurora | Baguio City | Batac, Ilocos Norte | Region II | Bayombong, Nueva Vizcaya | Basco, Batanes | Calayan, Cagayan | Region III | Iba, Zambales | Region IV-A | Baybay City, Leyte | Infanta, Quezon | CAR | La Trinidad, Benguet | Region VIII | Eastern Visayas | Northern Samar | Eastern Samar";
-        typhoons.push_back(t13);
-
-        // Nando
-        Typhoon t14;
-        t14.name = "Nando";
-        t14.arrival = "2000_09/18";
-        t14.departure = "0000_09/24";
-        t14.month = "September";
-        t14.interval = "6";
-        t14.stormCrossing = "Land";
-        t14.timeOfLandfall = "2025-09-22 3:00";
-        t14.developed = "WITHIN THE PAR";
-        t14.pathType = "West-northwestward";
-        t14.levels = "Super Typhoon";
-        t14.windSpeed = 215;
-        t14.casualties = 200;
-        t14.damages = 0.0;
-        t14.placesAffected = "Region I | Batanes (Basco, Sabtang, Itbayat) | Cagayan (Calayan, Aparri, Tuguegarao) | Ilocos Norte (Batac, Laoag) | Ilocos Sur (Vigan, Candon) | La Union (San Fernando) | Region II | Nueva Vizcaya (Bayombong) | Isabela (Ilagan, Santiago) | Quirino (Diffun) | CAR (Cordillera Administrative Region) | Benguet (La Trinidad, Baguio City) | Apayao (Kabugao) | Kalinga (Tabuk) | Region III | Zambales (Iba, Olongapo) | Bataan (Balanga) | Pampanga (San Fernando) | Tarlac (Tarlac City) | Region IV-A (CALABARZON) | Quezon (Infanta, Lucban) | Rizal (Tanay, Antipolo) | Laguna (San Pablo)";
-        typhoons.push_back(t14);
-
-        // Opong
-        Typhoon t15;
-        t15.name = "Opong";
-        t15.arrival = "1600_09/23";
-        t15.departure = "0000_09/27";
-               t15.month = "September";
-        t15.interval = "4";
-        t15.stormCrossing = "Land";
-        t15.timeOfLandfall = "2025-09-26 23:30";
-        t15.developed = "WITHIN THE PAR";
-        t15.pathType = "West to Northward";
-        t15.levels = "Tropical Storm";
-        t15.windSpeed = 120;
-        t15.casualties = 19;
-        t15.damages = 1000000000.0;
-        t15.placesAffected = "Region V / Bicol / Eastern Visayas / MIMAROPA | Eastern Samar (San Policarpo, Arteche, Maslog, Oras, Sulat) | Northern Samar | Samar (Catbalogan City, other towns) | Biliran | Masbate (Masbate City, Aroroy, Mobo, Uson, Dimasalang, Cataingan, Pio V. Corpuz) | Romblon | Occidental Mindoro | Oriental Mindoro (Calapan City, Naujan, Bulalacao, Puerto Galera, Pinamalayan, San Teodoro, Roxas) | Southern Luzon / MIMAROPA coastal areas affected by enhanced southwest monsoon";
-        typhoons.push_back(t15);
-
-        // Paolo
-        Typhoon t16;
-        t16.name = "Paolo";
-        t16.arrival = "1100_10/01";
-        t16.departure = "0500_10/04";
-        t16.month = "October";
-        t16.interval = "4";
-        t16.stormCrossing = "Land";
-        t16.timeOfLandfall = "2025-10-03 10:00";
-        t16.developed = "WITHIN THE PAR";
-        t16.pathType = "West-northwestward";
-        t16.levels = "Tropical Storm";
-        t16.windSpeed = 135;
-        t16.casualties = 1;
-        t16.damages = 11000000.0;
-        t16.placesAffected = "Region I | Ilocos Region | Northern Ilocos Norte | Region II | Cagayan Valley | Batanes | Babuyan Islands | Region V | Bicol Region | Bicol Region (General) | Region IV-A | CALABARZON | Quezon | Region VIII | Eastern Visayas | Northern Samar | Eastern Samar";
-        typhoons.push_back(t16);
-
-        // Quedan
-        Typhoon t17;
-        t17.name = "Quedan";
-        t17.arrival = "1240_10/09";
-        t17.departure = "0200_10/10";
-        t17.month = "October";
-        t17.interval = "1";
-        t17.stormCrossing = "Water";
-        t17.timeOfLandfall = "None";
-        t17.developed = "Outside the PAR";
-        t17.pathType = "northeastward";
-        t17.levels = "Tropical Storm";
-        t17.windSpeed = 70;
-        t17.casualties = 0;
-        t17.damages = 0.0;
-        t17.placesAffected = "Region I | Ilocos Region | Northern Ilocos Norte | Region II | Cagayan Valley | Batanes | Babuyan Islands | Region V | Bicol Region | Bicol Region (General) | Region IV-A | CALABARZON | Quezon | Region VIII | Eastern Visayas | Northern Samar | Eastern Samar";
-        typhoons.push_back(t17);
-
-        // Ramil
-        Typhoon t18;
-        t18.name = "Ramil";
-        t18.arrival = "1800_10/17";
-        t18.departure = "0800_10/20";
-        t18.month = "October";
-        t18.interval = "3";
-        t18.stormCrossing = "Land";
-        t18.timeOfLandfall = "2025-10-18 - 14:00";
-        t18.developed = "WITHIN THE PAR";
-        t18.pathType = "West-northwestward";
-        t18.levels = "Tropical Storm";
-        t18.windSpeed = 65;
-        t18.casualties = 7;
-        t18.damages = 0.0;
-        t18.placesAffected = "Region I | Ilocos Region | Ilocos Norte (Laoag, Batac, Pagudpud) | La Union (San Fernando, Bacnotan) | Pangasinan (Dagupan, Lingayen) | Region II | Cagayan Valley | Cagayan (Tuguegarao, Aparri) | Isabela (Ilagan, Santiago) | Nueva Vizcaya (Bayombong) | Quirino (Diffun) | Batanes (Basco) | Babuyan Islands (Calayan, Camiguin Norte) | Region IV-A | CALABARZON | Quezon (Polillo, Infanta, Lucban) | Rizal (Tanay, Antipolo) | Laguna (San Pablo, Calamba) | Region V | Bicol Region | Camarines Norte (Daet, Labo) | Camarines Sur (Naga, Pili) | Albay (Legazpi, Tabaco) | Sorsogon (Sorsogon City, Bulan) | Region VIII | Eastern Visayas | Northern Samar (Catarman, Laoang) | Eastern Samar (Borongan, San Policarpo)";
-        typhoons.push_back(t18);
-
-        // Salome
-        Typhoon t19;
-        t19.name = "Salome";
-        t19.arrival = "0800_10/22";
-        t19.departure = "1230_11/05";
-        t19.month = "October";
-        t19.interval = "1";
-        t19.stormCrossing = "Water";
-        t19.timeOfLandfall = "05:00_10/23";
-        t19.developed = "WITHIN THE PAR";
-        t19.pathType = "Northwestward";
-        t19.levels = "Tropical Depression";
-        t19.windSpeed = 55;
-        t19.casualties = 0;
-        t19.damages = 10000000.0;
-        t19.placesAffected = "Region I | Ilocos Region | Northern Ilocos Norte | Region II | Cagayan Valley | Batanes | Babuyan Islands | Region V | Bicol Region | Bicol Region (General) | Region IV-A | CALABARZON | Quezon | Region VIII | Eastern Visayas | Northern Samar | Eastern Samar";
-        typhoons.push_back(t19);
-
-        // Tino
-        Typhoon t20;
-        t20.name = "Tino";
-        t20.arrival = "0530_11/02";
-        t20.departure = "0500_11/11";
-        t20.month = "November";
-        t20.interval = "3";
-        t20.stormCrossing = "Land";
-        t20.timeOfLandfall = "12:00_11/04";
-        t20.developed = "OUTSIDE THE PAR";
-        t20.pathType = "West-Northwestward";
-        t20.levels = "Tropical Storm";
-        t20.windSpeed = 85;
-               t20.casualties = 253;
-        t20.damages = 974000000.0;
-        t20.placesAffected = "Region V | Bicol Region | Masbate | Sorsogon | Albay | Region VI | Western Visayas | Iloilo | Negros Occidental | Capiz | Antique | Guimaras | Region VII | Central Visayas | Cebu | Siquijor | Bohol | Region VIII | Eastern Visayas | Southern Leyte | Leyte | Eastern Samar | Northern Samar | Region IV-A | CALABARZON | Quezon | Marinduque | Region IV-B | MIMAROPA | Palawan | Occidental Mindoro | Romblon | Region XIII | Caraga | Dinagat Island | Surigao Del Norte";
-        typhoons.push_back(t20);
-
-        // Uwan
-        Typhoon t21;
-        t21.name = "Uwan";
-        t21.arrival = "2200_11/07";
-        t21.departure = "0200_11/27";
-        t21.month = "November";
-        t21.interval = "4";
-        t21.stormCrossing = "Land";
-        t21.timeOfLandfall = "21:10_11/09";
-        t21.developed = "OUTSIDE THE PAR";
-        t21.pathType = "Northeastward";
-        t21.levels = "Super Typoon";
-        t21.windSpeed = 185;
-        t21.casualties = 33;
-        t21.damages = 818740000.0;
-        t21.placesAffected = "Region V | Bicol Region | Masbate | Sorsogon | Albay | Region VI | Western Visayas | Iloilo | Negros Occidental | Capiz | Antique | Guimaras | Region VII | Central Visayas | Cebu | Siquijor | Bohol | Region VIII | Eastern Visayas | Southern Leyte | Leyte | Eastern Samar | Northern Samar | Region IV-A | CALABARZON | Quezon | Marinduque | Region IV-B | MIMAROPA | Palawan | Occidental Mindoro | Romblon | Region XIII | Caraga | Dinagat Island | Surigao Del Norte";
-        typhoons.push_back(t21);
-
-        // Verbena
-        Typhoon t22;
-        t22.name = "Verbena";
-        t22.arrival = "0200_11/24";
-        t22.departure = "1100_12/09";
-        t22.month = "November";
-        t22.interval = "3";
-        t22.stormCrossing = "Land";
-        t22.timeOfLandfall = "2:40_11/25";
-        t22.developed = "WITHIN THE PAR";
-        t22.pathType = "West-Northwestward";
-        t22.levels = "Tropical Depression";
-        t22.windSpeed = 140;
-        t22.casualties = 0;
-        t22.damages = 0.0;
-        t22.placesAffected = "Region IV-B | MIMAROPA | Palawan | Oriental Mindoro | Region VI | Western Visayas | Iloilo | Capiz | Negros Occidental | Region VIII | Eastern Visayas | Southern Leyte | Region X | Northern Mindanao | Lanao del Norte | Misamis Oriental | Camiguin | Region XIII | Caraga | Surigao del Sur | Butuan City | Dinagat Islands | Agusan del Norte";
-        typhoons.push_back(t22);
-
-        // Wilma
-        Typhoon t23;
-        t23.name = "Wilma";
-        t23.arrival = "0600_12/05";
-        t23.departure = "0800_12/07";
-        t23.month = "December";
-        t23.interval = "2";
-        t23.stormCrossing = "Land";
-        t23.timeOfLandfall = "2025-12-06 22:50";
-        t23.developed = "WITHIN THE PAR";
-        t23.pathType = "West-Southwestward";
-        t23.levels = "Tropical Depression";
-        t23.windSpeed = 55;
-        t23.casualties = 0;
-        t23.damages = 0.0;
-        t23.placesAffected = "Region IV-A | Quezon | Rizal | Laguna | Batangas | Region IV-B | Oriental Mindoro | Occidental Mindoro | Palawan | Romblon | Region V | Sorsogon | Masbate | Region VI | Iloilo | Capiz | Antique | Region VII | Cebu | Bohol | Negros Oriental | Region VIII | Samar | Eastern Samar | Northern Samar | Leyte | Southern Leyte | Region XIII | Dinagat Islands | Agusan del Norte | Surigao del Norte";
-        typhoons.push_back(t23);
-    } 
-    else {
-        cout << "Error: Invalid year. Only 2024 or 2025 supported." << endl;
-    }
-    return typhoons;
-}
-
-// Function to get typhoons for a specific month and year
-vector<Typhoon> getTyphoonsForMonth(const vector<Typhoon>& typhoons, int month) {
-    vector<Typhoon> result;
-    for (const auto& t : typhoons) {
-        if (getMonthInt(t.month) == month) {  // FIXED: was getMonth()
-            result.push_back(t);
-        }
-    }
-    return result;
-}
-
-// Function to display typhoon details
-void displayTyphoons(const vector<Typhoon>& typhoons) {
-    if (typhoons.empty()) {
-        cout << "No typhoons recorded for this month." << endl;
-        return;
-    }
-    for (const auto& t : typhoons) {
-        cout << "Name: " << t.name << endl;
-        cout << "Arrival (PAR): " << t.arrival << endl;
-        cout << "Departure (PAR): " << t.departure << endl;
-        cout << "Month: " << t.month << endl;
-        cout << "Interval: " << t.interval << endl;
-        cout << "Storm Crossing: " << t.stormCrossing << endl;
-        cout << "Time of Landfall: " << t.timeOfLandfall << endl;
-        cout << "Developed: " << t.developed << endl;
-        cout << "Path Type: " << t.pathType << endl;
-        cout << "Levels: " << t.levels << endl;
-        cout << "Wind Speed: " << t.windSpeed << " km/h" << endl;
-        cout << "Casualties: " << t.casualties << endl;
-        cout << "Damages: " << fixed << setprecision(2) << t.damages << " Peso" << endl;
-        cout << "Places Affected: " << t.placesAffected << endl;
-        cout << "----------------------------------------" << endl;
-    }
-}
-// Function to display resolutions/recommendations
-void displayResolutions(int year) {
-    cout << "-- Resolution(s) / Recommendation(s) for " << year << " --" << endl;
-    if (year == 2024) {
-        cout << "** Government **" << endl;
-        cout << "- Increase funding for rapid evacuation systems due to high casualty rates." << endl;
-        cout << "- Implement stricter zoning laws in coastal areas affected by multiple typhoons." << endl;
-        cout << "- Enhance collaboration with local governments for real-time data sharing." << endl;
-        cout << "- Invest in mental health support for disaster survivors." << endl;
-        cout << "- Develop national typhoon preparedness campaigns targeting vulnerable populations." << endl;
-
-        cout << "** Community **" << endl;
-        cout << "- Organize local training sessions on first aid and emergency response." << endl;
-        cout << "- Establish community watch groups for early typhoon warnings." << endl;
-        cout << "- Promote household emergency kits with focus on food and water storage." << endl;
-        cout << "- Foster neighborhood support networks for post-typhoon recovery." << endl;
-        cout << "- Encourage sustainable farming practices to reduce environmental vulnerability." << endl;
-
-        cout << "** Improvements **" << endl;
-        cout << "- Upgrade weather radar systems for better storm tracking accuracy." << endl;
-        cout << "- Integrate AI-driven prediction models for casualty minimization." << endl;
-        cout << "- Improve data collection on human impacts for future planning." << endl;
-        cout << "- Develop mobile apps for personalized evacuation alerts." << endl;
-        cout << "- Enhance communication infrastructure to prevent information gaps." << endl;
-
-        cout << "** Advance Preparedness **" << endl;
-        cout << "- Conduct annual simulation drills in high-risk areas." << endl;
-        cout << "- Stockpile medical supplies in advance of typhoon season." << endl;
-        cout << "- Train volunteers in search and rescue operations." << endl;
-        cout << "- Create digital maps for safe evacuation routes." << endl;
-        cout << "- Implement early warning systems in schools and hospitals." << endl;
-    } else if (year == 2025) {
-        cout << "** Government **" << endl;
-        cout << "- Allocate budgets for infrastructure repair following extensive damages." << endl;
-        cout << "- Enforce building codes with typhoon-resistant materials." << endl;
-        cout << "- Partner with international aid for long-term recovery." << endl;
-        cout << "- Introduce tax incentives for disaster-resilient construction." << endl;
-        cout << "- Establish a national fund for typhoon damage compensation." << endl;
-
-        cout << "** Community **" << endl;
-        cout << "- Build community shelters with improved durability." << endl;
-        cout << "- Educate on insurance options for property protection." << endl;
-        cout << "- Promote reforestation to mitigate future storm intensity." << endl;
-        cout << "- Organize workshops on damage assessment and reporting." << endl;
-        cout << "- Strengthen family emergency plans with focus on economic recovery." << endl;
-
-        cout << "** Improvements **" << endl;
-        cout << "- Invest in satellite technology for precise damage mapping." << endl;
-        cout << "- Develop predictive analytics for economic impact reduction." << endl;
-        cout << "- Upgrade communication networks for uninterrupted service." << endl;
-        cout << "- Integrate drone technology for rapid post-storm surveys." << endl;
-        cout << "- Enhance data analytics for trend analysis in typhoon patterns." << endl;
-
-        cout << "** Advance Preparedness **" << endl;
-        cout << "- Create regional stockpiles of construction materials." << endl;
-        cout << "- Train engineers in quick infrastructure restoration." << endl;
-        cout << "- Develop apps for real-time damage reporting." << endl;
-        cout << "- Conduct vulnerability assessments annually." << endl;
-        cout << "- Establish partnerships with NGOs for sustained support." << endl;
-    } else {
-        cout << "No specific resolutions available for this year." << endl;
-    }
-}
-
-// Function for search: Top 3 Strongest Typhoons
-void searchTop3Strongest(const vector<Typhoon>& typhoons2024, const vector<Typhoon>& typhoons2025) {
-    vector<Typhoon> all = typhoons2024;
-    all.insert(all.end(), typhoons2025.begin(), typhoons2025.end());
-    sort(all.begin(), all.end(), [](const Typhoon& a, const Typhoon& b) {
-        return a.windSpeed > b.windSpeed;
-    });
-
-    cout << "-- Top 3 Strongest Typhoons from 2024 - 2025 --" << endl;
-    for (int i = 0; i < min(3, (int)all.size()); ++i) {
-        cout << (i + 1) << ". " << all[i].name << " - " << all[i].windSpeed << " km/h" << endl;
-    }
-
-    cout << "1. Comments" << endl;
-    cout << "2. Menu" << endl;
-    cout << "3. Back" << endl;
-    int choice;
-    while (true) {
-        cout << "Enter your choice: ";
-        cin >> choice;
-        if (cin.fail()) {
-            cin.clear();
-            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-            cout << "Invalid input. Please enter a number." << endl;
-            continue;
-        }
-        if (choice == 1) {
-            cout << "-- Comments --" << endl;
-            cout << "These top typhoons highlight the need for advanced wind-resistant infrastructure and early warning systems." << endl;
-            cout << "1. Menu" << endl;
-            cout << "2. Back" << endl;
-            cout << "Enter your choice: ";
-            cin >> choice;
-            if (cin.fail()) {
-                cin.clear();
-                cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                continue;
-            }
-            if (choice == 1) break;
-        } else if (choice == 2) {
-            break;
-        } else if (choice == 3) {
-            // Stay in search
-        } else {
-            cout << "Invalid choice." << endl;
-        }
-    }
-}
-
-// Function for search: Most Damaging Typhoon
-void searchMostDamaging(const vector<Typhoon>& typhoons2024, const vector<Typhoon>& typhoons2025) {
-    vector<Typhoon> all = typhoons2024;
-    all.insert(all.end(), typhoons2025.begin(), typhoons2025.end());
-    if (all.empty()) {
-        cout << "No typhoon data available." << endl;
-        return;
-    }
-    Typhoon most = *max_element(all.begin(), all.end(), [](const Typhoon& a, const Typhoon& b) {
-        return a.damages < b.damages;
-    });
-
-    cout << "The " << most.name
-         << " is considered the most damaging typhoon that entered the Philippines with "
-         << fixed << setprecision(2) << most.damages << " pesos in cost of damage." << endl;
-
-    cout << "1. Comments" << endl;
-    cout << "2. Menu" << endl;
-    cout << "3. Back" << endl;
-    int choice;
-    while (true) {
-        cout << "Enter your choice: ";
-        cin >> choice;
-        if (cin.fail()) {
-            cin.clear();
-            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-            cout << "Invalid input. Please enter a number." << endl;
-            continue;
-        }
-        if (choice == 1) {
-            cout << "-- Comments --" << endl;
-            cout << "This typhoon caused significant economic losses, highlighting the need for better infrastructure and financial preparedness." << endl;
-            cout << "1. Menu" << endl;
-            cout << "2. Back" << endl;
-            cin >> choice;
-            if (cin.fail()) {
-                cin.clear();
-                cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                continue;
-            }
-            if (choice == 1) break;
-        } else if (choice == 2) {
-            break;
-        } else if (choice == 3) {
-            // Stay in search
-        } else {
-            cout << "Invalid choice." << endl;
-        }
-    }
-}
-
-// Function for search: List all names alphabetically
-void searchAlphabetical(const vector<Typhoon>& typhoons2024, const vector<Typhoon>& typhoons2025) {
-    vector<Typhoon> all = typhoons2024;
-    all.insert(all.end(), typhoons2025.begin(), typhoons2025.end());
-    sort(all.begin(), all.end(), [](const Typhoon& a, const Typhoon& b) {
-        return a.name < b.name;
-    });
-
-    cout << "-- List of Typhoons from 2024 - 2025 (A-Z) --" << endl;
-    for (const auto& t : all) {
-        cout << t.name << endl;
-    }
-
-    cout << "1. Comments" << endl;
-    cout << "2. Menu" << endl;
-    cout << "3. Back" << endl;
-
-    int choice;
-    while (true) {
-        cout << "Enter your choice: ";
-        cin >> choice;
-        if (cin.fail()) {
-            cin.clear();
-            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-            cout << "Invalid input. Please enter a number." << endl;
-            continue;
-        }
-        if (choice == 1) {
-            cout << "-- Comments --" << endl;
-            cout << "Listing typhoons alphabetically aids in systematic tracking and historical analysis." << endl;
-            cout << "1. Menu" << endl;
-            cout << "2. Back" << endl;
-            cout << "Enter your choice: ";
-            cin >> choice;
-            if (cin.fail()) {
-                cin.clear();
-                cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                continue;
-            }
-            if (choice == 1) break;
-        } else if (choice == 2) {
-            break;
-        } else if (choice == 3) {
-            // Stay in search
-        } else {
-            cout << "Invalid choice." << endl;
-        }
-    }
-}
-
-// Function for search: Longest Stay
-void searchLongestStay(const vector<Typhoon>& typhoons2024, const vector<Typhoon>& typhoons2025) {
-    vector<Typhoon> all = typhoons2024;
-    all.insert(all.end(), typhoons2025.begin(), typhoons2025.end());
-    if (all.empty()) {
-        cout << "No typhoon data available." << endl;
-        return;
-    }
-    Typhoon longest = *max_element(all.begin(), all.end(), [](const Typhoon& a, const Typhoon& b) {
-        try {
-            return stoi(a.interval) < stoi(b.interval);
-        } catch (...) {
-            return false;
-        }
-    });
-
-    cout << "The " << longest.name << " had the longest stay with " << longest.interval << " days." << endl;
-    cout << "1. Comments" << endl;
-    cout << "2. Menu" << endl;
-    cout << "3. Back" << endl;
-
-    int choice;
-    while (true) {
-        cout << "Enter your choice: ";
-        cin >> choice;
-        if (cin.fail()) {
-            cin.clear();
-            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-            cout << "Invalid input. Please enter a number." << endl;
-            continue;
-        }
-        if (choice == 1) {
-            cout << "-- Comments --" << endl;
-            cout << "Extended stays increase exposure time, necessitating prolonged preparedness measures." << endl;
-            cout << "1. Menu" << endl;
-            cout << "2. Back" << endl;
-            cout << "Enter your choice: ";
-            cin >> choice;
-            if (cin.fail()) {
-                cin.clear();
-                cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                continue;
-            }
-            if (choice == 1) break;
-        } else if (choice == 2) {
-            break;
-        } else if (choice == 3) {
-            // Stay in search
-        } else {
-            cout << "Invalid choice." << endl;
-        }
-    }
-}
-
-// Function for search: Sort by Landfall
-void searchLandfall(const vector<Typhoon>& typhoons2024, const vector<Typhoon>& typhoons2025) {
-    vector<Typhoon> all = typhoons2024;
-    all.insert(all.end(), typhoons2025.begin(), typhoons2025.end());
-
-    vector<Typhoon> landfall;
-    for (const auto& t : all) {
-        if (t.stormCrossing == "Land") {
-            landfall.push_back(t);
-        }
-    }
-
-    cout << "-- Typhoons that made Landfall --" << endl;
-    for (const auto& t : landfall) {
-        cout << t.name << endl;
-    }
-
-    cout << "1. Comments" << endl;
-    cout << "2. Menu" << endl;
-    cout << "3. Back" << endl;
-    int choice;
-    while (true) {
-        cout << "Enter your choice: ";
-        cin >> choice;
-        if (cin.fail()) {
-            cin.clear();
-            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-            cout << "Invalid input. Please enter a number." << endl;
-            continue;
-        }
-        if (choice == 1) {
-            cout << "-- Comments --" << endl;
-            cout << "Landfall typhoons pose direct threats, requiring focused coastal defense strategies." << endl;
-            cout << "1. Menu" << endl;
-            cout << "2. Back" << endl;
-            cout << "Enter your choice: ";
-            cin >> choice;
-            if (cin.fail()) {
-                cin.clear();
-                cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                continue;
-            }
-            if (choice == 1) break;
-        } else if (choice == 2) {
-            break;
-        } else if (choice == 3) {
-            // Stay in search
-        } else {
-            cout << "Invalid choice." << endl;
-        }
-    }
-}
-
-int main() {
-    vector<Typhoon> typhoons2024 = loadTyphoons(2024);
-    vector<Typhoon> typhoons2025 = loadTyphoons(2025);
-
-    int choice;
-    bool running = true;
-
-    while (running) {
-        cout << "\nWelcome to ClimaScope\n" << endl << endl;
-        cout << " Homepage " << endl;
-        cout << "1. Swipe Up" << endl;
-        cout << "2. Search" << endl;
-        cout << "3. Menu" << endl;
-        cout << "4. Exit the Execution" << endl;
-        cout << "Enter your choice: ";
-        cin >> choice;
-        if (cin.fail()) {
-            cin.clear();
-            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-            cout << "Invalid input. Please enter a number." << endl;
-            continue;
-        }
-
-        switch (choice) {
-            case 1: { // Swipe Up -> Year
-                bool inYear = true;
-                while (inYear) {
-                    cout << "----------------------------------------" << endl;
-                    cout << "– Year –" << endl;
-                    cout << "1. 2024" << endl;
-                    cout << "2. 2025" << endl;
-                    cout << "3. Menu" << endl;
-                    cout << "4. Back" << endl;
-                    cout << "Enter your choice: ";
-                    cin >> choice;
-                    if (cin.fail()) {
-                        cin.clear();
-                        cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                        cout << "Invalid input. Please enter a number." << endl;
-                        continue;
-                    }
-                    switch (choice) {
-                        case 1: { // 2024
-                            bool inMonths2024 = true;
-                            while (inMonths2024) {
-                                cout << "----------------------------------------" << endl;
-                                cout << "– Months that has typhoon(s) for 2024 –" << endl;
-                                cout << "1. May" << endl;
-                                cout << "2. July" << endl;
-                                cout << "3. August" << endl;
-                                cout << "4. September" << endl;
-                                cout << "5. October" << endl;
-                                cout << "6. November" << endl;
-                                cout << "7. December" << endl;
-                                cout << "8. Back" << endl;
-                                cout << "9. Menu" << endl;
-                                cout << "Enter your choice: ";
-                                cin >> choice;
-                                if (cin.fail()) {
-                                    cin.clear();
-                                    cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                                    cout << "Invalid input. Please enter a number." << endl;
-                                    continue;
-                                }
-                                if (choice >= 1 && choice <= 7) {
-                                    int month = (choice == 1) ? 5 :
-                                                (choice == 2) ? 7 :
-                                                (choice == 3) ? 8 :
-                                                (choice == 4) ? 9 :
-                                                (choice == 5) ? 10 :
-                                                (choice == 6) ? 11 : 12;
-
-                                    vector<Typhoon> monthTyphoons = getTyphoonsForMonth(typhoons2024, month);
-                                    cout << "----------------------------------------" << endl;
-                                    cout << "– Typhoon(s) for the month of "
-                                         << ((choice == 1) ? "May" :
-                                             (choice == 2) ? "July" :
-                                             (choice == 3) ? "August" :
-                                             (choice == 4) ? "September" :
-                                             (choice == 5) ? "October" :
-                                             (choice == 6) ? "November" : "December")
-                                         << " 2024 –" << endl;
-                                    displayTyphoons(monthTyphoons);
-                                    cout << "1. Resolution(s) / Recommendation(s) for 2024" << endl;
-                                    cout << "2. Menu" << endl;
-                                    cout << "3. Back" << endl;
-                                    cout << "Enter your choice: ";
-                                    cin >> choice;
-                                    if (cin.fail()) {
-                                        cin.clear();
-                                        cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                                        cout << "Invalid input. Please enter a number." << endl;
-                                        continue;
-                                    }
-                                    switch (choice) {
-                                        case 1:
-                                            displayResolutions(2024);
-                                            cout << "1. Menu" << endl;
-                                            cout << "2. Back" << endl;
-                                            cin >> choice;
-                                            if (cin.fail()) {
-                                                cin.clear();
-                                                cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                                                continue;
-                                            }
-                                            if (choice == 1) inMonths2024 = false;
-                                            break;
-                                        case 2:
-                                            inMonths2024 = false;
-                                            break;
-                                        case 3:
-                                            break; // Back to months
-                                        default:
-                                            cout << "Invalid choice." << endl;
-                                    }
-                                } else if (choice == 8) {
-                                    inMonths2024 = false;
-                                } else if (choice == 9) {
-                                    inMonths2024 = false;
-                                    inYear = false;
-                                } else {
-                                    cout << "Invalid choice." << endl;
-                                }
-                            }
-                            break;
-                        }
-                        case 2: { // 2025
-                            bool inMonths2025 = true;
-                            while (inMonths2025) {
-                                cout << "----------------------------------------" << endl;
-                                cout << "– Months that has typhoon(s) for 2025 –" << endl;
-                                cout << "1. July" << endl;
-                                cout << "2. August" << endl;
-                                cout << "3. September" << endl;
-                                cout << "4. October" << endl;
-                                cout << "5. November" << endl;
-                                cout << "6. December" << endl;
-                                cout << "7. Back" << endl;
-                                cout << "8. Menu" << endl;
-                                cout << "Enter your choice: ";
-                                cin >> choice;
-                                if (cin.fail()) {
-                                    cin.clear();
-                                    cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                                    cout << "Invalid input. Please enter a number." << endl;
-                                    continue;
-                                }
-                                if (choice >= 1 && choice <= 6) {
-                                    int month = (choice == 1) ? 7 :
-                                                (choice == 2) ? 8 :
-                                                (choice == 3) ? 9 :
-                                                (choice == 4) ? 10 :
-                                                (choice == 5) ? 11 : 12;
-
-                                    vector<Typhoon> monthTyphoons = getTyphoonsForMonth(typhoons2025, month);
-                                    cout << "----------------------------------------" << endl;
-                                    cout << "– Typhoon(s) for the month of "
-                                         << ((choice == 1) ? "July" :
-                                             (choice == 2) ? "August" :
-                                             (choice == 3) ? "September" :
-                                             (choice == 4) ? "October" :
-                                             (choice == 5) ? "November" : "December")
-                                         << " 2025 –" << endl;
-                                    displayTyphoons(monthTyphoons);
-                                    cout << "1. Resolution(s) / Recommendation(s) for 2025" << endl;
-                                    cout << "2. Menu" << endl;
-                                    cout << "3. Back" << endl;
-                                    cout << "Enter your choice: ";
-                                    cin >> choice;
-                                    if (cin.fail()) {
-                                        cin.clear();
-                                        cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                                        cout << "Invalid input. Please enter a number." << endl;
-                                        continue;
-                                    }
-                                    switch (choice) {
-                                        case 1:
-                                            displayResolutions(2025);
-                                            cout << "1. Menu" << endl;
-                                            cout << "2. Back" << endl;
-                                            cin >> choice;
-                                            if (cin.fail()) {
-                                                cin.clear();
-                                                cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                                                continue;
-                                            }
-                                            if (choice == 1) inMonths2025 = false;
-                                            break;
-                                        case 2:
-                                            inMonths2025 = false;
-                                            break;
-                                        case 3:
-                                            break; // Back to months
-                                        default:
-                                            cout << "Invalid choice." << endl;
-                                    }
-                                } else if (choice == 7) {
-                                    inMonths2025 = false;
-                                } else if (choice == 8) {
-                                    inMonths2025 = false;
-                                    inYear = false;
-                                } else {
-                                    cout << "Invalid choice." << endl;
-                                }
-                            }
-                            break;
-                        }
-                        case 3: // Menu
-                            inYear = false;
-                            break;
-                        case 4: // Back
-                            inYear = false;
-                            break;
-                        default:
-                            cout << "Invalid choice." << endl;
-                    }
-                }
-                break;
-            }
-            case 2: { // Search
-                bool inSearch = true;
-                while (inSearch) {
-                    cout << "----------------------------------------" << endl;
-                    cout << "– Searching –" << endl;
-                    cout << "1. Top 3 Strongest Typhoons from 2024 - 2025 (Based on their Wind Speed)" << endl;
-                    cout << "2. Most Damaging Typhoon (Based on the cost in Peso)" << endl;
-                    cout << "3. List all names of Typhoons from 2024 - 2025 by Alphabetical Order (A-Z)" << endl;
-                    cout << "4. Longest Stay in Land (Arrival to Departure)" << endl;
-                    cout << "5. Sort all typhoons that made Landfall (Based on Storm Crossing)" << endl;
-                    cout << "Enter your choice: ";
-                    cin >> choice;
-                    if (cin.fail()) {
-                        cin.clear();
-                        cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                        cout << "Invalid input. Please enter a number." << endl;
-                        continue;
-                    }
-                    switch (choice) {
-                        case 1:
-                            searchTop3Strongest(typhoons2024, typhoons2025);
-                            break;
-                        case 2:
-                            searchMostDamaging(typhoons2024, typhoons2025);
-                            break;
-                        case 3:
-                            searchAlphabetical(typhoons2024, typhoons2025);
-                            break;
-                        case 4:
-                            searchLongestStay(typhoons2024, typhoons2025);
-                            break;
-                        case 5:
-                            searchLandfall(typhoons2024, typhoons2025);
-                            break;
-                        default:
-                            cout << "Invalid choice." << endl;
-                    }
-                    cout << "1. Menu" << endl;
-                    cout << "2. Back" << endl;
-                    cout << "Enter your choice: ";
-                    cin >> choice;
-                    if (cin.fail()) {
-                        cin.clear();
-                        cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                        cout << "Invalid input. Please enter a number." << endl;
-                        continue;
-                    }
-                    if (choice == 1) inSearch = false;
-                    // If 2, stay in search
-                }
-                break;
-            }
-            case 3: { // Menu
-                bool inMenu = true;
-                while (inMenu) {
-                    cout << "----------------------------------------" << endl;
-                    cout << "– Menu –" << endl;
-                    cout << "1. Home" << endl;
-                    cout << "2. Contact" << endl;
-                    cout << "3. Setting" << endl;
-                    cout << "4. About" << endl;
-                    cout << "Enter your choice: ";
-                    cin >> choice;
-                    if (cin.fail()) {
-                        cin.clear();
-                        cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                        cout << "Invalid input. Please enter a number." << endl;
-                        continue;
-                    }
-                    switch (choice) {
-                        case 1: // Home
-                            inMenu = false;
-                            break;
-                        case 2: { // Contact
-                            bool inContact = true;
-                            while (inContact) {
-                                cout << "----------------------------------------" << endl;
-                                cout << "– Contact Us –" << endl;
-                                cout << "1. Location" << endl;
-                                cout << "2. Email" << endl;
-                                cout << "3. Tel No." << endl;
-                                cout << "– Follow Us –" << endl;
-                                cout << "4. Facebook" << endl;
-                                cout << "5. X (Twitter)" << endl;
-                                cout << "6. Instagram" << endl;
-                                cout << "Enter your choice: ";
-                                cin >> choice;
-                                if (cin.fail()) {
-                                    cin.clear();
-                                    cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                                    cout << "Invalid input. Please enter a number." << endl;
-                                    continue;
-                                }
-                                switch (choice) {
-                                    case 1:
-                                        cout << "----------------------------------------" << endl;
-                                        cout << "– Location –" << endl;
-                                        cout << "629 J. Nepomuceno Street, Quiapo, Manila, Philippines 1001" << endl;
-                                        cout << "1. Menu" << endl;
-                                        cout << "2. Back" << endl;
-                                        cin >> choice;
-                                        if (cin.fail()) {
-                                            cin.clear();
-                                            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                                            continue;
-                                        }
-                                        if (choice == 1) inContact = false;
-                                        break;
-                                    case 2:
-                                        cout << "----------------------------------------" << endl;
-                                        cout << "– Email –" << endl;
-                                        cout << "info@climascopo.ph" << endl;
-                                        cout << "1. Menu" << endl;
-                                        cout << "2. Back" << endl;
-                                        cin >> choice;
-                                        if (cin.fail()) {
-                                            cin.clear();
-                                            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                                            continue;
-                                        }
-                                        if (choice == 1) inContact = false;
-                                        break;
-                                    case 3:
-                                        cout << "----------------------------------------" << endl;
-                                        cout << "– Tel No. –" << endl;
-                                        cout << "+63 2 123 4567" << endl;
-                                        cout << "1. Menu" << endl;
-                                        cout << "2. Back" << endl;
-                                        cin >> choice;
-                                        if (cin.fail()) {
-                                            cin.clear();
-                                            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                                            continue;
-                                        }
-                                        if (choice == 1) inContact = false;
-                                        break;
-                                    case 4:
-                                        cout << "----------------------------------------" << endl;
-                                        cout << "– Facebook –" << endl;
-                                        cout << "Link: www.Facebook.com/clima-scope/jfdihiefuh483nUT7GAYUYgubed/source=?/k" << endl;
-                                        cout << "1. Menu" << endl;
-                                        cout << "2. Back" << endl;
-                                        cin >> choice;
-                                        if (cin.fail()) {
-                                            cin.clear();
-                                            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                                            continue;
-                                        }
-                                        if (choice == 1) inContact = false;
-                                        break;
-                                    case 5:
-                                        cout << "----------------------------------------" << endl;
-                                        cout << "– X (Twitter) –" << endl;
-                                        cout << "Link: www.twitter.com/climascopo" << endl;
-                                        cout << "1. Menu" << endl;
-                                        cout << "2. Back" << endl;
-                                        cin >> choice;
-                                        if (cin.fail()) {
-                                            cin.clear();
-                                            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                                            continue;
-                                        }
-                                        if (choice == 1) inContact = false;
-                                        break;
-                                    case 6:
-                                        cout << "----------------------------------------" << endl;
-                                        cout << "– Instagram –" << endl;
-                                        cout << "Link: www.instagram.com/climascopo" << endl;
-                                        cout << "1. Menu" << endl;
-                                        cout << "2. Back" << endl;
-                                        cin >> choice;
-                                        if (cin.fail()) {
-                                            cin.clear();
-                                            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                                            continue;
-                                        }
-                                        if (choice == 1) inContact = false;
-                                        break;
-                                    default:
-                                        cout << "Invalid choice." << endl;
-                                }
-                            }
-                            break;
-                        }
-                        case 3: { // Setting
-                            bool inSetting = true;
-                            while (inSetting) {
-                                cout << "----------------------------------------" << endl;
-                                cout << "– Settings –" << endl;
-                                cout << "1. Preference" << endl;
-                                cout << "2. Notifications" << endl;
-                                cout << "3. Legal & Policies" << endl;
-                                cout << "4. Help" << endl;
-                                cout << "5. Report Technical Problem" << endl;
-                                cout << "6. Rate Us" << endl;
-                                cout << "7. Menu" << endl;
-                                cout << "Enter your Choice: ";
-                                cin >> choice;
-                                if (cin.fail()) {
-                                    cin.clear();
-                                    cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                                    cout << "Invalid input. Please enter a number." << endl;
-                                    continue;
-                                }
-                                switch (choice) {
-                                    case 1: { // Preference
-                                        bool inPreference = true;
-                                        while (inPreference) {
-                                            cout << "----------------------------------------" << endl;
-                                            cout << "– Preference –" << endl;
-                                            cout << "1. Dark Mode" << endl;
-                                            cout << "2. Default" << endl;
-                                            cout << "3. Menu" << endl;
-                                            cout << "4. Back" << endl;
-                                            cout << "Enter your choice: ";
-                                            cin >> choice;
-                                            if (cin.fail()) {
-                                                cin.clear();
-                                                cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                                                cout << "Invalid input. Please enter a number." << endl;
-                                                continue;
-                                            }
-                                            switch (choice) {
-                                                case 1:
-                                                    cout << "----------------------------------------" << endl;
-                                                    cout << "– Dark Mode has been applied –" << endl;
-                                                    cout << "1. Menu" << endl;
-                                                    cout << "2. Back" << endl;
-                                                    cin >> choice;
-                                                    if (cin.fail()) {
-                                                        cin.clear();
-                                                        cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                                                        continue;
-                                                    }
-                                                    if (choice == 1) inPreference = false;
-                                                    break;
-                                                case 2:
-                                                    cout << "----------------------------------------" << endl;
-                                                    cout << "– Default Mode has been applied –" << endl;
-                                                    cout << "1. Menu" << endl;
-                                                    cout << "2. Back" << endl;
-                                                    cin >> choice;
-                                                    if (cin.fail()) {
-                                                        cin.clear();
-                                                        cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                                                        continue;
-                                                    }
-                                                    if (choice == 1) inPreference = false;
-                                                    break;
-                                                case 3:
-                                                    inPreference = false;
-                                                    break;
-                                                case 4:
-                                                    inPreference = false;
-                                                    break;
-                                                default:
-                                                    cout << "Invalid choice." << endl;
-                                            }
-                                        }
-                                        break;
-                                    }
-                                    case 2:
-                                        cout << "----------------------------------------" << endl;
-                                        cout << "– Notifications –" << endl;
-                                        cout << "Notifications settings here." << endl;
-                                        cout << "1. Menu" << endl;
-                                        cout << "2. Back" << endl;
-                                        cin >> choice;
-                                        if (cin.fail()) {
-                                            cin.clear();
-                                            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                                            continue;
-                                        }
-                                        if (choice == 1) inSetting = false;
-                                        break;
-                                    case 3:
-                                        cout << "----------------------------------------" << endl;
-                                        cout << "– Legal & Policies –" << endl;
-                                        cout << "Privacy Policy and Terms of Service text here." << endl;
-                                        cout << "1. Menu" << endl;
-                                        cout << "2. Back" << endl;
-                                        cin >> choice;
-                                        if (cin.fail()) {
-                                            cin.clear();
-                                            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                                            continue;
-                                        }
-                                        if (choice == 1) inSetting = false;
-                                        break;
-                                    case 4:
-                                        cout << "----------------------------------------" << endl;
-                                        cout << "– Help –" << endl;
-                                        cout << "Help information here." << endl;
-                                        cout << "1. Menu" << endl;
-                                        cout << "2. Back" << endl;
-                                        cin >> choice;
-                                        if (cin.fail()) {
-                                            cin.clear();
-                                            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                                            continue;
-                                        }
-                                        if (choice == 1) inSetting = false;
-                                        break;
-                                    case 5:
-                                        cout << "----------------------------------------" << endl;
-                                        cout << "– Report Technical Problem –" << endl;
-                                        cout << "Report form here." << endl;
-                                        cout << "1. Menu" << endl;
-                                        cout << "2. Back" << endl;
-                                        cin >> choice;
-                                        if (cin.fail()) {
-                                            cin.clear();
-                                            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                                            continue;
-                                        }
-                                        if (choice == 1) inSetting = false;
-                                        break;
-                                    case 6:
-                                        cout << "----------------------------------------" << endl;
-                                        cout << "– Rate Us –" << endl;
-                                        cout << "Rating system here." << endl;
-                                        cout << "1. Menu" << endl;
-                                        cout << "2. Back" << endl;
-                                        cin >> choice;
-                                        if (cin.fail()) {
-                                            cin.clear();
-                                            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                                            continue;
-                                        }
-                                        if (choice == 1) inSetting = false;
-                                        break;
-                                    case 7:
-                                        inSetting = false;
-                                        break;
-                                    default:
-                                        cout << "Invalid choice." << endl;
-                                }
-                            }
-                            break;
-                        }
-                        case 4: { // About
-                            cout << "----------------------------------------" << endl;
-                            cout << "– About –" << endl;
-                            cout << "\"ClimaScope: Tracking, Impact, and Climate Solutions for Philippine Typhoons.\"" << endl;
-                            cout << "\"ClimaScope is a comprehensive platform that tracks typhoons in the Philippines, analyzes their impact, and provides climate-smart solutions to support preparedness and resilience.\"" << endl;
-                            cout << "– Privacy policy –" << endl;
-                            cout << "– Terms of Service –" << endl;
-                            cout << "1. Back" << endl;
-                            cout << "2. Menu" << endl;
-                            cin >> choice;
-                            if (cin.fail()) {
-                                cin.clear();
-                                cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                                cout << "Invalid input. Please enter a number." << endl;
-                                continue;
-                            }
-                            if (choice == 2) inMenu = false;
-                            break;
-                        }
-                        default:
-                            cout << "Invalid choice." << endl;
-                    }
-                }
-                break;
-            }
-            case 4: // Exit
-                running = false;
-                break;
-            default:
-                cout << "Invalid choice." << endl;
-        }
-    }
-    return 0;
-}
-
-
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <unordered_map>
+#include <cctype>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <charconv>
+#include <cstdint>
+#include <string_view>
+#include <thread>
+#include <atomic>
+#include <type_traits>
+#include <queue>
+#include <memory>
+#include <chrono>
+#include <mutex>
+#include <deque>
+#include <list>
+#include <csignal>
+#include <functional>
+#include <cerrno>
+#ifdef _WIN32
+#define NOMINMAX
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#include <windows.h>
+#include <intrin.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#endif
+#include "allocation_counter.h"
+
+using namespace std;
+
+// Marks an arrival/departure/landfall time that is missing or could not be parsed
+const int32_t NO_TIMESTAMP = numeric_limits<int32_t>::min();
+
+// Bump allocator for record text. Strings are copied into large blocks and handed out as
+// string_views; nothing is freed on its own, the whole arena is released at once. Blocks never
+// move, so views stay valid when the arena itself is moved or adopted by another arena.
+class StringArena {
+public:
+    static const size_t FIRST_BLOCK_BYTES = 4 << 10;
+    static const size_t BLOCK_BYTES = 1 << 20;
+
+    // Function to reserve n bytes. Large requests get a block of their own, placed before the
+    // current block so small strings keep filling it.
+    char* allocate(size_t n) {
+        if (n > left) {
+            if (n > BLOCK_BYTES / 4) {
+                reservedBytes += n;
+                usedBytes += n;
+                return blocks.emplace(blocks.end() - (cursor ? 1 : 0), new char[n])->get();
+            }
+            // Blocks double from FIRST_BLOCK_BYTES up to BLOCK_BYTES, so small tables stay small
+            blockBytes = max(n, min(BLOCK_BYTES, max(FIRST_BLOCK_BYTES, blockBytes * 2)));
+            blocks.emplace_back(new char[blockBytes]);
+            reservedBytes += blockBytes;
+            cursor = blocks.back().get();
+            left = blockBytes;
+        }
+        char* p = cursor;
+        cursor += n;
+        left -= n;
+        usedBytes += n;
+        return p;
+    }
+    string_view store(string_view text) {
+        if (text.empty()) return string_view();
+        char* p = allocate(text.size());
+        memcpy(p, text.data(), text.size());
+        return string_view(p, text.size());
+    }
+    // Function to take over every block of another arena; views into it stay valid
+    void adopt(StringArena&& other) {
+        blocks.insert(blocks.end() - (cursor ? 1 : 0), make_move_iterator(other.blocks.begin()),
+                      make_move_iterator(other.blocks.end()));
+        if (!cursor) {
+            cursor = other.cursor;
+            left = other.left;
+            blockBytes = other.blockBytes;
+        }
+        usedBytes += other.usedBytes;
+        reservedBytes += other.reservedBytes;
+        other = StringArena();
+    }
+    // Function to release every string at once, keeping the current block for reuse
+    void clear() {
+        unique_ptr<char[]> current = cursor ? move(blocks.back()) : nullptr;
+        blocks.clear();
+        cursor = current.get();
+        left = cursor ? blockBytes : 0;
+        reservedBytes = left;
+        usedBytes = 0;
+        if (current) blocks.push_back(move(current));
+    }
+    size_t bytesUsed() const { return usedBytes; }
+    size_t bytesReserved() const { return reservedBytes; }
+
+private:
+    vector<unique_ptr<char[]>> blocks;
+    char* cursor = nullptr;
+    size_t left = 0;
+    size_t blockBytes = 0; // size of the current block
+    size_t usedBytes = 0;
+    size_t reservedBytes = 0;
+};
+
+// Struct to hold typhoon data. The text fields are views: into the loader's StringArena, a
+// mapped snapshot or whatever else produced the record, which must outlive it.
+struct Typhoon {
+    int year = 0;
+    string_view name;
+    string_view arrival; // Format: military time_MM/DD
+    string_view departure; // Format: military time_MM/DD
+    string_view month;
+    string_view interval;
+    string_view stormCrossing;
+    string_view timeOfLandfall;
+    string_view developed;
+    string_view pathType;
+    string_view levels;
+    int windSpeed = 0;
+    int casualties = 0;
+    double damages = 0.0; // in Peso
+    string_view placesAffected;
+    // Parsed once at load time, in minutes since 1970-01-01 00:00 (PHT); NO_TIMESTAMP if absent
+    int32_t arrivalTime = NO_TIMESTAMP;
+    int32_t departureTime = NO_TIMESTAMP;
+    int32_t landfallTime = NO_TIMESTAMP;
+};
+
+// Interned dictionary for a low-cardinality text column. Values are stored once and records
+// keep a compact code; the first entries are seeded so their codes can be used as enum constants.
+template <typename Code>
+struct Dictionary {
+    vector<string> values;
+    unordered_map<string, Code> codes;
+
+    Dictionary(initializer_list<const char*> seed = {}) {
+        for (const char* s : seed) intern(s);
+    }
+    Code intern(const string& value) {
+        auto it = codes.find(value);
+        if (it != codes.end()) return it->second;
+        if (values.size() > numeric_limits<Code>::max()) return 0; // full: falls back to code 0
+        Code code = static_cast<Code>(values.size());
+        values.push_back(value);
+        codes.emplace(value, code);
+        return code;
+    }
+    const string& text(Code code) const { return values[code]; }
+};
+
+// Preset codes for the interned columns (code 0 is always the empty/unknown value)
+enum CrossingCode : uint8_t { CROSSING_UNKNOWN, CROSSING_LAND, CROSSING_WATER };
+enum DevelopedCode : uint8_t { DEVELOPED_UNKNOWN, DEVELOPED_WITHIN_PAR, DEVELOPED_OUTSIDE_PAR };
+enum LevelCode : uint8_t {
+    LEVEL_UNKNOWN, LEVEL_TROPICAL_DEPRESSION, LEVEL_TROPICAL_STORM, LEVEL_SEVERE_TROPICAL_STORM,
+    LEVEL_TYPHOON, LEVEL_SUPER_TYPHOON
+};
+
+Dictionary<uint16_t> seededPlaceDictionary();
+
+// Bit helpers for the packed place bitsets
+inline int countTrailingZeros(uint64_t word) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(word);
+#endif
+}
+
+inline int popCount(uint64_t word) {
+#ifdef _MSC_VER
+    return static_cast<int>(__popcnt64(word));
+#else
+    return __builtin_popcountll(word);
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// Column kernels
+//
+// Filters and reductions over the contiguous numeric columns. Each kernel has a scalar version
+// and, on x86-64, an AVX2 version compiled for that target only; simdLevel picks one at startup
+// from what the CPU reports, so the binary still runs on machines without AVX2. Both versions
+// return the same rows and values for NaN-free columns (ties resolve to the lowest index).
+// ---------------------------------------------------------------------------
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define CLIMASCOPE_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#define TARGET_AVX2
+#else
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+enum SimdLevel { SIMD_SCALAR, SIMD_AVX2 };
+
+// Function to find the widest kernel set the CPU supports
+SimdLevel detectSimdLevel() {
+#if defined(CLIMASCOPE_X86) && defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return SIMD_SCALAR;
+    __cpuid(info, 1);
+    const bool osSavesYmm = (info[2] & (1 << 27)) && (_xgetbv(0) & 6) == 6;
+    __cpuidex(info, 7, 0);
+    return osSavesYmm && (info[1] & (1 << 5)) ? SIMD_AVX2 : SIMD_SCALAR;
+#elif defined(CLIMASCOPE_X86)
+    return __builtin_cpu_supports("avx2") ? SIMD_AVX2 : SIMD_SCALAR;
+#else
+    return SIMD_SCALAR;
+#endif
+}
+
+SimdLevel simdLevel = detectSimdLevel(); // --simd scalar forces the scalar kernels
+
+// Function to append begin + i for every i in [0, n) with keep(i), returning the new row count.
+// rows must have room for n more entries past count.
+template <typename Keep>
+size_t selectScalar(size_t n, uint32_t begin, uint32_t* rows, size_t count, Keep keep) {
+    for (size_t i = 0; i < n; ++i) {
+        rows[count] = begin + static_cast<uint32_t>(i);
+        count += keep(i);
+    }
+    return count;
+}
+
+#ifdef CLIMASCOPE_X86
+// For each 8-bit lane mask, the lane numbers of its set bits packed to the front
+struct CompressTable {
+    alignas(32) uint32_t lanes[256][8];
+    CompressTable() {
+        for (int mask = 0; mask < 256; ++mask) {
+            int n = 0;
+            for (int lane = 0; lane < 8; ++lane) {
+                if (mask & (1 << lane)) lanes[mask][n++] = lane;
+            }
+            while (n < 8) lanes[mask][n++] = 0;
+        }
+    }
+};
+const CompressTable compressTable;
+
+// Function to store base + lane for the set lanes of an 8-bit mask at rows[count] (writes 8 slots)
+TARGET_AVX2 inline size_t compressRows8(uint32_t mask, uint32_t base, uint32_t* rows, size_t count) {
+    const __m256i order = _mm256_load_si256(reinterpret_cast<const __m256i*>(compressTable.lanes[mask]));
+    const __m256i packed = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(base)), order);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(rows + count), packed);
+    return count + popCount(mask);
+}
+
+TARGET_AVX2 size_t selectRangeInt32Avx2(const int32_t* column, size_t n, uint32_t begin, int32_t low, int32_t high,
+                                        uint32_t* rows, size_t count) {
+    const __m256i lo = _mm256_set1_epi32(low), hi = _mm256_set1_epi32(high);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(column + i));
+        const __m256i outside = _mm256_or_si256(_mm256_cmpgt_epi32(lo, v), _mm256_cmpgt_epi32(v, hi));
+        const uint32_t keep = ~static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(outside))) & 0xFF;
+        count = compressRows8(keep, begin + static_cast<uint32_t>(i), rows, count);
+    }
+    return selectScalar(n - i, begin + static_cast<uint32_t>(i), rows, count, [&](size_t j) {
+        return column[i + j] >= low && column[i + j] <= high;
+    });
+}
+
+TARGET_AVX2 size_t selectRangeDoubleAvx2(const double* column, size_t n, uint32_t begin, double low, double high,
+                                         uint32_t* rows, size_t count) {
+    const __m256d lo = _mm256_set1_pd(low), hi = _mm256_set1_pd(high);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m256d a = _mm256_loadu_pd(column + i), b = _mm256_loadu_pd(column + i + 4);
+        const int inA = _mm256_movemask_pd(_mm256_and_pd(_mm256_cmp_pd(a, lo, _CMP_GE_OQ), _mm256_cmp_pd(a, hi, _CMP_LE_OQ)));
+        const int inB = _mm256_movemask_pd(_mm256_and_pd(_mm256_cmp_pd(b, lo, _CMP_GE_OQ), _mm256_cmp_pd(b, hi, _CMP_LE_OQ)));
+        count = compressRows8(static_cast<uint32_t>(inA | (inB << 4)), begin + static_cast<uint32_t>(i), rows, count);
+    }
+    return selectScalar(n - i, begin + static_cast<uint32_t>(i), rows, count, [&](size_t j) {
+        return column[i + j] >= low && column[i + j] <= high;
+    });
+}
+
+TARGET_AVX2 size_t selectEqualU8Avx2(const uint8_t* column, size_t n, uint32_t begin, uint8_t code,
+                                     uint32_t* rows, size_t count) {
+    const __m256i wanted = _mm256_set1_epi8(static_cast<char>(code));
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(column + i));
+        const uint32_t keep = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, wanted)));
+        for (uint32_t part = 0; part < 32; part += 8) {
+            count = compressRows8((keep >> part) & 0xFF, begin + static_cast<uint32_t>(i + part), rows, count);
+        }
+    }
+    return selectScalar(n - i, begin + static_cast<uint32_t>(i), rows, count, [&](size_t j) {
+        return column[i + j] == code;
+    });
+}
+
+// Function to find the largest value of an int32 column (n >= 8)
+TARGET_AVX2 int32_t maxInt32Avx2(const int32_t* column, size_t n) {
+    __m256i best = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(column));
+    size_t i = 8;
+    for (; i + 8 <= n; i += 8) {
+        best = _mm256_max_epi32(best, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(column + i)));
+    }
+    alignas(32) int32_t lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), best);
+    int32_t value = *max_element(lanes, lanes + 8);
+    for (; i < n; ++i) value = max(value, column[i]);
+    return value;
+}
+
+// Function to find the first index holding value in an int32 column
+TARGET_AVX2 size_t findInt32Avx2(const int32_t* column, size_t n, int32_t value) {
+    const __m256i wanted = _mm256_set1_epi32(value);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(column + i));
+        const int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, wanted)));
+        if (mask) return i + countTrailingZeros(static_cast<uint32_t>(mask));
+    }
+    while (i < n && column[i] != value) ++i;
+    return i;
+}
+
+// Function to find the largest value of a double column (n >= 4, no NaN)
+TARGET_AVX2 double maxDoubleAvx2(const double* column, size_t n) {
+    __m256d best = _mm256_loadu_pd(column);
+    size_t i = 4;
+    for (; i + 4 <= n; i += 4) best = _mm256_max_pd(best, _mm256_loadu_pd(column + i));
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, best);
+    double value = *max_element(lanes, lanes + 4);
+    for (; i < n; ++i) value = max(value, column[i]);
+    return value;
+}
+
+// Function to find the first index holding value in a double column
+TARGET_AVX2 size_t findDoubleAvx2(const double* column, size_t n, double value) {
+    const __m256d wanted = _mm256_set1_pd(value);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const int mask = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(column + i), wanted, _CMP_EQ_OQ));
+        if (mask) return i + countTrailingZeros(static_cast<uint32_t>(mask));
+    }
+    while (i < n && column[i] != value) ++i;
+    return i;
+}
+
+// Function to find the smallest and largest value of an int32 column (n >= 8)
+TARGET_AVX2 void minMaxInt32Avx2(const int32_t* column, size_t n, int32_t& low, int32_t& high) {
+    __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(column)), hi = lo;
+    size_t i = 8;
+    for (; i + 8 <= n; i += 8) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(column + i));
+        lo = _mm256_min_epi32(lo, v);
+        hi = _mm256_max_epi32(hi, v);
+    }
+    alignas(32) int32_t lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), lo);
+    low = *min_element(lanes, lanes + 8);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), hi);
+    high = *max_element(lanes, lanes + 8);
+    for (; i < n; ++i) {
+        low = min(low, column[i]);
+        high = max(high, column[i]);
+    }
+}
+#endif
+
+// Function to append the rows begin + i whose column[i] lies in [low, high]; returns the new count
+size_t selectRange(const int32_t* column, size_t n, uint32_t begin, int32_t low, int32_t high,
+                   uint32_t* rows, size_t count) {
+#ifdef CLIMASCOPE_X86
+    if (simdLevel == SIMD_AVX2) return selectRangeInt32Avx2(column, n, begin, low, high, rows, count);
+#endif
+    return selectScalar(n, begin, rows, count, [=](size_t i) { return column[i] >= low && column[i] <= high; });
+}
+
+size_t selectRange(const double* column, size_t n, uint32_t begin, double low, double high,
+                   uint32_t* rows, size_t count) {
+#ifdef CLIMASCOPE_X86
+    if (simdLevel == SIMD_AVX2) return selectRangeDoubleAvx2(column, n, begin, low, high, rows, count);
+#endif
+    return selectScalar(n, begin, rows, count, [=](size_t i) { return column[i] >= low && column[i] <= high; });
+}
+
+// Function to append the rows begin + i whose code column[i] equals code; returns the new count
+size_t selectEqual(const uint8_t* column, size_t n, uint32_t begin, uint8_t code, uint32_t* rows, size_t count) {
+#ifdef CLIMASCOPE_X86
+    if (simdLevel == SIMD_AVX2) return selectEqualU8Avx2(column, n, begin, code, rows, count);
+#endif
+    return selectScalar(n, begin, rows, count, [=](size_t i) { return column[i] == code; });
+}
+
+// Function to find the first index of the largest value of a column (n > 0)
+size_t argMax(const int32_t* column, size_t n) {
+#ifdef CLIMASCOPE_X86
+    if (simdLevel == SIMD_AVX2 && n >= 8) return findInt32Avx2(column, n, maxInt32Avx2(column, n));
+#endif
+    size_t best = 0;
+    for (size_t i = 1; i < n; ++i) {
+        if (column[i] > column[best]) best = i;
+    }
+    return best;
+}
+
+size_t argMax(const double* column, size_t n) {
+#ifdef CLIMASCOPE_X86
+    if (simdLevel == SIMD_AVX2 && n >= 4) {
+        const size_t best = findDoubleAvx2(column, n, maxDoubleAvx2(column, n));
+        if (best < n) return best; // not found only if the column holds NaN: rescan below
+    }
+#endif
+    size_t best = 0;
+    for (size_t i = 1; i < n; ++i) {
+        if (column[i] > column[best]) best = i;
+    }
+    return best;
+}
+
+// Function to find the smallest and largest value of a column (n > 0)
+void minMax(const int32_t* column, size_t n, int32_t& low, int32_t& high) {
+#ifdef CLIMASCOPE_X86
+    if (simdLevel == SIMD_AVX2 && n >= 8) return minMaxInt32Avx2(column, n, low, high);
+#endif
+    low = high = column[0];
+    for (size_t i = 1; i < n; ++i) {
+        low = min(low, column[i]);
+        high = max(high, column[i]);
+    }
+}
+
+// Name index entry: a storm name folded to lower case, and its row. A name given as
+// "Local (International)" or "Local/International" has an entry for each part.
+struct NameKey {
+    string_view key;
+    uint32_t row;
+    bool international;
+};
+
+// Groups of columns a table tracks changes of, so a cached result is only dropped when a column
+// it read changed
+enum ColumnGroup : unsigned {
+    COLUMNS_NAME = 1 << 0,
+    COLUMNS_DATES = 1 << 1, // year, month, arrival, departure, landfall time, interval, stay
+    COLUMNS_WIND = 1 << 2,
+    COLUMNS_CASUALTIES = 1 << 3,
+    COLUMNS_DAMAGES = 1 << 4,
+    COLUMNS_CLASS = 1 << 5, // storm crossing, developed, path type, level
+    COLUMNS_PLACES = 1 << 6,
+    COLUMNS_ALL = (1 << 7) - 1
+};
+const int COLUMN_GROUP_COUNT = 7;
+
+// Source of table ids and versions; shared by all tables so a rebuilt table never repeats a version
+// and a new table never reuses the id of a freed one
+atomic<uint64_t> tableVersionClock{0};
+
+// What one placesAffected token resolves to: the codes of its provinces/regions, or none when it
+// names no seeded place
+struct PlaceTokenCodes {
+    vector<uint16_t> codes;
+    bool resolved;
+};
+
+// Columnar (structure-of-arrays) storage for typhoon records. Each field lives in its own
+// contiguous column, so scans over the numeric fields only touch the bytes they read.
+struct TyphoonTable {
+    // Identifies the table in result cache keys. A clone keeps the id: its column and month
+    // versions tell which of its cached results still hold.
+    uint64_t id = ++tableVersionClock;
+    vector<int> year;
+    vector<unsigned char> monthNumber; // 1-12, 0 if the month name is unknown
+    vector<int> windSpeed;
+    vector<int> casualties;
+    vector<double> damages;
+    vector<int32_t> arrivalTime;
+    vector<int32_t> departureTime;
+    vector<int32_t> landfallTime;
+    vector<int32_t> stayHours; // arrival to departure, whole hours; -1 if unknown
+    // Text columns are views into the table's own arena
+    vector<string_view> name;
+    vector<string_view> arrival;
+    vector<string_view> departure;
+    vector<string_view> month;
+    vector<string_view> interval;
+    vector<string_view> timeOfLandfall;
+    vector<string_view> placesAffected; // as written; placeBits below holds what it resolves to
+    StringArena text;
+    // Interned columns; use the dictionaries below for the display text
+    vector<uint8_t> stormCrossing;
+    vector<uint8_t> developed;
+    vector<uint8_t> levels;
+    vector<uint16_t> pathType;
+    Dictionary<uint8_t> crossingNames{"", "Land", "Water"};
+    Dictionary<uint8_t> developedNames{"", "WITHIN THE PAR", "OUTSIDE THE PAR"};
+    Dictionary<uint8_t> levelNames{"", "Tropical Depression", "Tropical Storm", "Severe Tropical Storm",
+                                   "Typhoon", "Super Typhoon"};
+    Dictionary<uint16_t> pathTypeNames{""};
+    // Affected places as a fixed-width bitset per row: row i owns
+    // placeBits[i * placeWords .. (i + 1) * placeWords), bit c set = place code c was hit.
+    // Only seeded provinces and regions get codes; other place names are counted in
+    // unresolvedPlaces and only appear in the text.
+    Dictionary<uint16_t> placeNames = seededPlaceDictionary();
+    size_t placeWords = 2;
+    vector<uint64_t> placeBits;
+    size_t unresolvedPlaces = 0;
+
+    // (year, month) -> row range index: rows of bucket b are
+    // monthIndexRows[monthIndexStart[b] .. monthIndexStart[b + 1]), b = yearSlot(year) * 13 + month.
+    // indexYears holds the distinct years in order, so a stray year costs 13 buckets, not a gap.
+    vector<int> indexYears;
+    vector<uint32_t> monthIndexStart;
+    vector<uint32_t> monthIndexRows;
+    // Name index, sorted by key, then displayed name, then row; keys live in the arena
+    vector<NameKey> nameIndex;
+    // Change versions: per column group, and per month index bucket for the rows it holds. Set
+    // fresh when the month index is built, bumped by insertRecord and replaceRecord.
+    uint64_t columnVersion[COLUMN_GROUP_COUNT] = {};
+    vector<uint64_t> bucketVersion;
+
+    size_t size() const { return name.size(); }
+    bool empty() const { return name.empty(); }
+    void reserve(size_t n);
+    void append(Typhoon&& t);
+    void appendTable(TyphoonTable&& part);
+    void buildMonthIndex();
+    void buildNameIndex();
+    // Single-record changes that keep the month and name indexes current (bulletins)
+    void insertRecord(Typhoon&& t);
+    void replaceRecord(size_t i, Typhoon&& t);
+    Typhoon record(size_t i) const;
+    TyphoonTable clone() const;
+    long findRecord(int recordYear, string_view stormName) const;
+    uint64_t columnsVersion(unsigned groups) const;
+    uint64_t monthVersion(int recordYear, int recordMonth) const;
+    // Position of a year in indexYears, or -1 if no row has that year
+    long yearSlot(int recordYear) const {
+        auto it = lower_bound(indexYears.begin(), indexYears.end(), recordYear);
+        return it != indexYears.end() && *it == recordYear ? long(it - indexYears.begin()) : -1;
+    }
+
+    const string& stormCrossingText(size_t i) const { return crossingNames.text(stormCrossing[i]); }
+    const string& developedText(size_t i) const { return developedNames.text(developed[i]); }
+    const string& levelsText(size_t i) const { return levelNames.text(levels[i]); }
+    const string& pathTypeText(size_t i) const { return pathTypeNames.text(pathType[i]); }
+    bool hitPlace(size_t i, uint16_t code) const {
+        return (placeBits[i * placeWords + code / 64] >> (code % 64)) & 1;
+    }
+    const uint64_t* placeRow(size_t i) const { return placeBits.data() + i * placeWords; }
+    void markPlace(size_t i, uint16_t code);
+
+private:
+    void resizeRows(size_t n);
+    void setRow(size_t i, const Typhoon& t);
+    size_t bucketOf(size_t i) const { return size_t(yearSlot(year[i])) * 13 + monthNumber[i]; }
+    void touch(unsigned groups, size_t bucket);
+    bool nameKeyBefore(const NameKey& a, const NameKey& b) const;
+    void indexMonth(size_t i);
+    void unindexMonth(size_t i);
+    void indexName(size_t i);
+    void unindexName(size_t i);
+    const PlaceTokenCodes& placeTokenCodes(string_view token);
+
+    // Resolved placesAffected tokens, so each distinct token is canonicalized once per table. Keys
+    // view the arena, which outlives them; a clone or a merged part starts with an empty map.
+    unordered_map<string_view, PlaceTokenCodes> resolvedPlaceTokens;
+};
+
+// Lightweight view over a run of row numbers in a TyphoonTable; never owns or copies records
+struct RowSpan {
+    const uint32_t* first = nullptr;
+    const uint32_t* last = nullptr;
+
+    const uint32_t* begin() const { return first; }
+    const uint32_t* end() const { return last; }
+    size_t size() const { return last - first; }
+    bool empty() const { return first == last; }
+};
+
+// Read-only view chaining any number of TyphoonTables (typically one per year). Rows are
+// numbered consecutively across the tables; nothing is copied when tables are added.
+class TyphoonDataset {
+public:
+    struct RowRef {
+        const TyphoonTable* table;
+        size_t row;
+    };
+
+    void add(const TyphoonTable& table) {
+        tables.push_back(&table);
+        offsets.push_back(offsets.back() + table.size());
+    }
+    size_t size() const { return offsets.back(); }
+    bool empty() const { return size() == 0; }
+    size_t tableCount() const { return tables.size(); }
+    const TyphoonTable& table(size_t t) const { return *tables[t]; }
+    size_t tableOffset(size_t t) const { return offsets[t]; }
+
+    // Function to resolve a dataset-wide row number to its table and local row
+    RowRef locate(size_t row) const {
+        size_t t = upper_bound(offsets.begin(), offsets.end(), row) - offsets.begin() - 1;
+        return {tables[t], row - offsets[t]};
+    }
+
+    int firstYear() const;
+    int lastYear() const;
+    size_t unresolvedPlaces() const;
+
+private:
+    vector<const TyphoonTable*> tables;
+    vector<size_t> offsets = {0};
+};
+
+// Path of the storm archive; override with --data <file>
+string dataFilePath = "typhoons.csv";
+
+bool loadTyphoonsFromFile(const string& path, int year, vector<Typhoon>& typhoons, StringArena& text);
+vector<Typhoon> loadTyphoons(int year, StringArena& text);
+TyphoonTable buildTable(vector<Typhoon>&& typhoons, bool parallel = true);
+RowSpan getTyphoonsForMonth(const TyphoonTable& table, int year, int month);
+void displayTyphoons(const TyphoonTable& table, RowSpan rows);
+void displayMonth(const TyphoonTable& table, int year, int month);
+void displayResolutions(int year);
+void searchTop3Strongest(const TyphoonDataset& dataset);
+void searchMostDamaging(const TyphoonDataset& dataset);
+void searchAlphabetical(const TyphoonDataset& dataset);
+void searchLongestStay(const TyphoonDataset& dataset);
+void searchLandfall(const TyphoonDataset& dataset);
+void searchByPlace(const TyphoonDataset& dataset);
+void searchPlacesHitInMonths(const TyphoonDataset& dataset);
+void searchTopK(const TyphoonDataset& dataset);
+void searchByName(const TyphoonDataset& dataset);
+
+// Function to convert month name to int
+int getMonthInt(string_view monthStr) {
+    static const map<string, int, less<>> monthMap = {
+        {"January", 1}, {"February", 2}, {"March", 3}, {"April", 4}, {"May", 5}, {"June", 6},
+        {"July", 7}, {"August", 8}, {"September", 9}, {"October", 10}, {"November", 11}, {"December", 12}
+    };
+    auto it = monthMap.find(monthStr);
+    return it != monthMap.end() ? it->second : 0;
+}
+
+// Function to count days since 1970-01-01 for a civil (proleptic Gregorian) date
+int32_t daysFromCivil(int year, int month, int day) {
+    year -= month <= 2;
+    const int era = (year >= 0 ? year : year - 399) / 400;
+    const int yoe = year - era * 400;
+    const int doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+// Function to convert days since 1970-01-01 back to a civil date
+void civilFromDays(int32_t days, int& year, int& month, int& day) {
+    days += 719468;
+    const int era = (days >= 0 ? days : days - 146096) / 146097;
+    const int doe = days - era * 146097;
+    const int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const int mp = (5 * doy + 2) / 153;
+    day = doy - (153 * mp + 2) / 5 + 1;
+    month = mp < 10 ? mp + 3 : mp - 9;
+    year = yoe + era * 400 + (month <= 2);
+}
+
+// Function to read an unsigned decimal number; returns the number of digits consumed
+int readDigits(const char*& p, const char* end, int& value) {
+    value = 0;
+    int digits = 0;
+    while (p < end && *p >= '0' && *p <= '9' && digits < 9) {
+        value = value * 10 + (*p - '0');
+        ++p;
+        ++digits;
+    }
+    return digits;
+}
+
+// Function to read a clock time: "HHMM", "H:MM" or "H:MM:SS"; returns minutes past midnight or -1
+int readClock(const char*& p, const char* end) {
+    int hour, minute = 0;
+    int digits = readDigits(p, end, hour);
+    if (digits == 0) return -1;
+    if (p < end && *p == ':') {
+        ++p;
+        if (readDigits(p, end, minute) != 2) return -1;
+        if (p < end && *p == ':') {
+            int seconds;
+            ++p;
+            if (readDigits(p, end, seconds) != 2) return -1;
+        }
+    } else if (digits == 3 || digits == 4) {
+        minute = hour % 100;
+        hour /= 100;
+    } else if (digits > 2) {
+        return -1;
+    }
+    if (hour > 23 || minute > 59) return -1;
+    return hour * 60 + minute;
+}
+
+// Function to parse a PAR/landfall timestamp into minutes since 1970-01-01 (PHT).
+// Accepted forms: "HHMM_MM/DD", "H:MM_MM/DD", "M/D/YYYY H:MM[:SS]", "YYYY-MM-DD H:MM" and
+// "YYYY-MM-DD - H:MM". Dates without a year use defaultYear. Returns NO_TIMESTAMP for "None",
+// empty or malformed input.
+int32_t parseTimestamp(string_view text, int defaultYear) {
+    const char* p = text.data();
+    const char* end = p + text.size();
+    while (p < end && *p == ' ') ++p;
+    while (end > p && end[-1] == ' ') --end;
+    if (p == end || *p < '0' || *p > '9') return NO_TIMESTAMP;
+
+    int year = defaultYear, month, day, clock;
+    const char* underscore = static_cast<const char*>(memchr(p, '_', end - p));
+    if (underscore) {
+        // Clock first, then "_MM/DD"
+        clock = readClock(p, underscore);
+        if (clock < 0 || p != underscore) return NO_TIMESTAMP;
+        p = underscore + 1;
+        if (readDigits(p, end, month) == 0 || p >= end || *p != '/') return NO_TIMESTAMP;
+        ++p;
+        if (readDigits(p, end, day) == 0) return NO_TIMESTAMP;
+        if (p < end && *p == '/') {
+            ++p;
+            if (readDigits(p, end, year) != 4) return NO_TIMESTAMP;
+        }
+    } else {
+        int first;
+        int digits = readDigits(p, end, first);
+        if (digits == 4 && p < end && *p == '-') {
+            // YYYY-MM-DD
+            year = first;
+            ++p;
+            if (readDigits(p, end, month) == 0 || p >= end || *p != '-') return NO_TIMESTAMP;
+            ++p;
+            if (readDigits(p, end, day) == 0) return NO_TIMESTAMP;
+        } else if (digits > 0 && digits <= 2 && p < end && *p == '/') {
+            // M/D/YYYY
+            month = first;
+            ++p;
+            if (readDigits(p, end, day) == 0 || p >= end || *p != '/') return NO_TIMESTAMP;
+            ++p;
+            if (readDigits(p, end, year) != 4) return NO_TIMESTAMP;
+        } else {
+            return NO_TIMESTAMP;
+        }
+        // Separator between date and clock: spaces, optionally around a dash
+        while (p < end && (*p == ' ' || *p == '-' || *p == 'T')) ++p;
+        clock = (p < end) ? readClock(p, end) : 0;
+        if (clock < 0) return NO_TIMESTAMP;
+    }
+    if (p != end || month < 1 || month > 12 || day < 1 || day > 31) return NO_TIMESTAMP;
+    return daysFromCivil(year, month, day) * 1440 + clock;
+}
+
+// Function to get the calendar month (1-12) of a parsed timestamp, 0 if absent
+int timestampMonth(int32_t minutes) {
+    if (minutes == NO_TIMESTAMP) return 0;
+    int32_t days = minutes >= 0 ? minutes / 1440 : (minutes - 1439) / 1440;
+    int year, month, day;
+    civilFromDays(days, year, month, day);
+    return month;
+}
+
+// Function to normalize the arrival, departure and landfall strings of a loaded record.
+// A departure that falls before arrival crossed into the next year.
+void parseTimestamps(Typhoon& t) {
+    t.arrivalTime = parseTimestamp(t.arrival, t.year);
+    t.departureTime = parseTimestamp(t.departure, t.year);
+    if (t.arrivalTime != NO_TIMESTAMP && t.departureTime != NO_TIMESTAMP && t.departureTime < t.arrivalTime) {
+        t.departureTime = parseTimestamp(t.departure, t.year + 1);
+    }
+    t.landfallTime = parseTimestamp(t.timeOfLandfall, t.year);
+}
+
+// Function to parse month from arrival/departure date (MM/DD), with error handling
+int getMonth(string_view date) {
+    return timestampMonth(parseTimestamp(date, 1970));
+}
+
+// ---------------------------------------------------------------------------
+// Instrumentation
+//
+// Scoped timers for the hot paths, switched on with --stats. Every operation keeps its call count,
+// wall time (including any operation nested inside it), the items it handled and the heap
+// allocations made while it ran. Allocations are counted by the allocation functions in
+// allocation_counter.cpp, so they read 0 in builds without it. With --stats off a timer costs one
+// branch.
+// ---------------------------------------------------------------------------
+
+enum StatId {
+    STAT_LOAD_FILE, STAT_OPEN_SNAPSHOT, STAT_BUILD_TABLE, STAT_BUILD_MONTH_INDEX, STAT_MONTH_LOOKUP,
+    STAT_DISPLAY_TYPHOONS, STAT_SEARCH_TOP3, STAT_SEARCH_TOP_K, STAT_SEARCH_MOST_DAMAGING,
+    STAT_SEARCH_ALPHABETICAL, STAT_SEARCH_LONGEST_STAY, STAT_SEARCH_LANDFALL, STAT_SEARCH_BY_PLACE,
+    STAT_SEARCH_PLACES_HIT, STAT_QUERY, STAT_BUILD_NAME_INDEX, STAT_SEARCH_BY_NAME, STAT_APPLY_BULLETIN,
+    STAT_CACHE_REPLAY, STAT_HTTP_REQUEST, STAT_PUBLISH_SNAPSHOT, STAT_COUNT
+};
+
+// Named after the function each operation times
+const char* const STAT_NAMES[STAT_COUNT] = {
+    "loadTyphoonsFromFile", "MappedArchive::open", "buildTable", "buildMonthIndex", "getTyphoonsForMonth",
+    "displayTyphoons", "searchTop3Strongest", "searchTopK", "searchMostDamaging",
+    "searchAlphabetical", "searchLongestStay", "searchLandfall", "searchByPlace",
+    "searchPlacesHitInMonths", "runQuery", "buildNameIndex", "searchByName", "applyBulletin",
+    "ResultCache::replay", "answerRequest", "SnapshotStore::applyBulletins"
+};
+
+// Items: records loaded or indexed, rows returned by month lookups, rows searched by searches/queries,
+// bulletins applied, bytes replayed from the result cache, response bytes of server requests,
+// tables copied for new snapshots. The totals are relaxed atomics, so server workers timing their
+// requests never wait for each other.
+struct OperationStats {
+    atomic<uint64_t> calls{0};
+    atomic<uint64_t> totalNanos{0};
+    atomic<uint64_t> maxNanos{0};
+    atomic<uint64_t> items{0};
+    atomic<uint64_t> allocations{0};
+    atomic<uint64_t> allocatedBytes{0};
+};
+
+bool statsEnabled = false; // --stats
+bool statsAsJson = false;  // --stats json
+OperationStats operationStats[STAT_COUNT];
+bool countAllocations = false;
+atomic<uint64_t> heapAllocations{0};
+atomic<uint64_t> heapAllocatedBytes{0};
+
+// Times one call of an operation, from construction to the end of the enclosing scope
+class ScopedTimer {
+public:
+    explicit ScopedTimer(StatId id) : id(id), active(statsEnabled) {
+        if (active) begin();
+    }
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+    ~ScopedTimer() {
+        if (active) record();
+    }
+    void addItems(uint64_t n) { items += n; }
+
+private:
+    // Kept out of line so a disabled timer adds no more than a branch to tiny operations
+#if defined(__GNUC__)
+    __attribute__((noinline))
+#endif
+    void begin() {
+        startAllocations = heapAllocations.load(memory_order_relaxed);
+        startBytes = heapAllocatedBytes.load(memory_order_relaxed);
+        start = chrono::steady_clock::now();
+    }
+#if defined(__GNUC__)
+    __attribute__((noinline))
+#endif
+    void record() {
+        const uint64_t nanos = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+        const uint64_t allocations = heapAllocations.load(memory_order_relaxed) - startAllocations;
+        const uint64_t bytes = heapAllocatedBytes.load(memory_order_relaxed) - startBytes;
+        OperationStats& stats = operationStats[id];
+        stats.calls.fetch_add(1, memory_order_relaxed);
+        stats.totalNanos.fetch_add(nanos, memory_order_relaxed);
+        uint64_t worst = stats.maxNanos.load(memory_order_relaxed);
+        while (nanos > worst && !stats.maxNanos.compare_exchange_weak(worst, nanos, memory_order_relaxed)) {
+        }
+        stats.items.fetch_add(items, memory_order_relaxed);
+        stats.allocations.fetch_add(allocations, memory_order_relaxed);
+        stats.allocatedBytes.fetch_add(bytes, memory_order_relaxed);
+    }
+
+    StatId id;
+    bool active;
+    uint64_t items = 0;
+    uint64_t startAllocations = 0;
+    uint64_t startBytes = 0;
+    chrono::steady_clock::time_point start;
+};
+
+// Parallel execution. Work is cut into fixed chunks that do not depend on the thread count;
+// workers claim the next unclaimed chunk from a shared counter (so fast workers take over the
+// rest of a slow worker's share) and each chunk fills its own partial result, merged afterwards
+// in chunk order. The results are therefore identical for any number of threads.
+unsigned workerThreads = 1; // --threads; 0 = one per hardware thread
+// Set on threads that already run side by side (server workers); their scans stay on that thread
+thread_local bool scanOnCallingThread = false;
+
+// Function to count the threads that will work on chunkCount chunks
+size_t threadsFor(size_t chunkCount) {
+    if (scanOnCallingThread) return 1;
+    size_t threads = workerThreads ? workerThreads : max(1u, thread::hardware_concurrency());
+    return min(threads, chunkCount);
+}
+
+
+// Function to run work(c) for every chunk index c in [0, chunkCount) on up to workerThreads threads
+template <typename Work>
+void parallelChunks(size_t chunkCount, Work work) {
+    const size_t threads = threadsFor(chunkCount);
+    if (threads <= 1) {
+        for (size_t c = 0; c < chunkCount; ++c) work(c);
+        return;
+    }
+    atomic<size_t> next{0};
+    auto worker = [&] {
+        for (size_t c = next.fetch_add(1); c < chunkCount; c = next.fetch_add(1)) work(c);
+    };
+    vector<thread> pool;
+    for (size_t t = 1; t < threads; ++t) pool.emplace_back(worker);
+    worker();
+    for (thread& t : pool) t.join();
+}
+
+// Function to parse one CSV field starting at p and return a pointer past the trailing delimiter
+// (or end). dst views the field in place; only a quoted field with doubled quotes ("") to undo
+// is copied, into text. Quoted fields may contain commas.
+const char* parseCsvField(const char* p, const char* end, string_view& dst, StringArena& text) {
+    if (p < end && *p == '"') {
+        ++p;
+        const char* q = static_cast<const char*>(memchr(p, '"', end - p));
+        if (!q || q + 1 == end || q[1] != '"') {
+            dst = string_view(p, (q ? q : end) - p);
+            p = q ? q + 1 : end;
+            return (p < end && *p == ',') ? p + 1 : end;
+        }
+        string unquoted;
+        while (p < end) {
+            const char* q = static_cast<const char*>(memchr(p, '"', end - p));
+            if (!q) { unquoted.append(p, end - p); p = end; break; }
+            unquoted.append(p, q - p);
+            p = q + 1;
+            if (p < end && *p == '"') { unquoted.push_back('"'); ++p; continue; }
+            break;
+        }
+        dst = text.store(unquoted);
+        return (p < end && *p == ',') ? p + 1 : end;
+    }
+    const char* q = static_cast<const char*>(memchr(p, ',', end - p));
+    if (!q) { dst = string_view(p, end - p); return end; }
+    dst = string_view(p, q - p);
+    return q + 1;
+}
+
+// Function to locate an unquoted numeric field without copying it
+const char* skipCsvField(const char* p, const char* end, const char*& fieldEnd) {
+    const char* q = static_cast<const char*>(memchr(p, ',', end - p));
+    fieldEnd = q ? q : end;
+    return q ? q + 1 : end;
+}
+
+// Function to parse a whole number field, ignoring surrounding spaces; an empty or blank field
+// is not a number and fails like any other text
+template <typename T>
+bool parseNumber(const char* b, const char* e, T& value) {
+    while (b < e && *b == ' ') ++b;
+    while (e > b && (e[-1] == ' ' || e[-1] == '\r')) --e;
+    if (b == e) return false;
+    auto res = from_chars(b, e, value);
+    return res.ec == errc() && res.ptr == e;
+}
+
+// Number of columns in an archive row, from year to placesAffected
+const size_t TYPHOON_CSV_FIELDS = 15;
+
+// Function to count the fields of one CSV line; commas inside quoted fields do not count
+size_t countCsvFields(const char* p, const char* end) {
+    size_t fields = 1;
+    bool quoted = false;
+    for (; p < end; ++p) {
+        if (*p == '"') quoted = !quoted;
+        else if (*p == ',' && !quoted) ++fields;
+    }
+    return fields;
+}
+
+// A skipped line, reported once all chunks are parsed (chunk-relative line numbers)
+struct LoadWarning {
+    size_t line;
+    const char* reason;
+};
+
+// Function to parse the CSV lines in [p, end) into records, returning the number of lines seen.
+// Records view their text in [p, end) or in text. Only the first line of the file (firstLine)
+// may be a header row.
+size_t parseTyphoonLines(const char* p, const char* end, int year, bool firstLine, vector<Typhoon>& typhoons,
+                         StringArena& text, vector<LoadWarning>& warnings) {
+    size_t lineNo = 0;
+    while (p < end) {
+        const char* lineEnd = static_cast<const char*>(memchr(p, '\n', end - p));
+        if (!lineEnd) lineEnd = end;
+        const char* nextLine = lineEnd < end ? lineEnd + 1 : end;
+        ++lineNo;
+        const char* e = lineEnd;
+        if (e > p && e[-1] == '\r') --e;
+        if (p == e || *p == '#') { p = nextLine; continue; }
+
+        const char* fe;
+        const char* next = skipCsvField(p, e, fe);
+        int recordYear;
+        if (!parseNumber(p, fe, recordYear)) {
+            if (!(firstLine && lineNo == 1)) warnings.push_back({lineNo, "invalid year"});
+            p = nextLine;
+            continue;
+        }
+        if (year != 0 && recordYear != year) { p = nextLine; continue; }
+        const size_t fields = countCsvFields(p, e);
+        if (fields != TYPHOON_CSV_FIELDS) {
+            warnings.push_back({lineNo, fields < TYPHOON_CSV_FIELDS ? "missing fields" : "too many fields"});
+            p = nextLine;
+            continue;
+        }
+        p = next;
+
+        typhoons.emplace_back();
+        Typhoon& t = typhoons.back();
+        t.year = recordYear;
+        p = parseCsvField(p, e, t.name, text);
+        p = parseCsvField(p, e, t.arrival, text);
+        p = parseCsvField(p, e, t.departure, text);
+        p = parseCsvField(p, e, t.month, text);
+        p = parseCsvField(p, e, t.interval, text);
+        p = parseCsvField(p, e, t.stormCrossing, text);
+        p = parseCsvField(p, e, t.timeOfLandfall, text);
+        p = parseCsvField(p, e, t.developed, text);
+        p = parseCsvField(p, e, t.pathType, text);
+        p = parseCsvField(p, e, t.levels, text);
+
+        bool ok = true;
+        next = skipCsvField(p, e, fe);
+        ok = ok && parseNumber(p, fe, t.windSpeed);
+        p = next;
+        next = skipCsvField(p, e, fe);
+        ok = ok && parseNumber(p, fe, t.casualties);
+        p = next;
+        next = skipCsvField(p, e, fe);
+        ok = ok && parseNumber(p, fe, t.damages);
+        p = next;
+        parseCsvField(p, e, t.placesAffected, text);
+        parseTimestamps(t);
+
+        if (!ok) {
+            warnings.push_back({lineNo, "invalid numeric field"});
+            typhoons.pop_back();
+        }
+        p = nextLine;
+    }
+    return lineNo;
+}
+
+// Function to load typhoons from a CSV archive.
+// Column order: year,name,arrival,departure,month,interval,stormCrossing,timeOfLandfall,
+//               developed,pathType,levels,windSpeed,casualties,damages,placesAffected
+// Pass year = 0 to load every year in the file. Returns false if the file cannot be opened.
+// The file is read in one go into text, and the records' fields view it in place. It is split
+// at line boundaries into LOAD_CHUNK_BYTES chunks, parsed in parallel into per-chunk record
+// lists which are then moved into typhoons in file order.
+const size_t LOAD_CHUNK_BYTES = 4 << 20;
+
+bool loadTyphoonsFromFile(const string& path, int year, vector<Typhoon>& typhoons, StringArena& text) {
+    ScopedTimer timer(STAT_LOAD_FILE);
+    ifstream in(path, ios::binary);
+    if (!in) {
+        cout << "Error: Cannot open typhoon data file '" << path << "'." << endl;
+        return false;
+    }
+    string_view data;
+    in.seekg(0, ios::end);
+    const streamoff fileSize = in.tellg();
+    in.seekg(0, ios::beg);
+    if (fileSize > 0) {
+        char* buffer = text.allocate(static_cast<size_t>(fileSize));
+        in.read(buffer, fileSize);
+        data = string_view(buffer, static_cast<size_t>(in.gcount()));
+    }
+
+    vector<pair<size_t, size_t>> chunks;
+    for (size_t start = 0; start < data.size();) {
+        size_t end = min(data.size(), start + LOAD_CHUNK_BYTES);
+        if (end < data.size()) {
+            const size_t newline = data.find('\n', end - 1);
+            end = newline == string_view::npos ? data.size() : newline + 1;
+        }
+        chunks.emplace_back(start, end);
+        start = end;
+    }
+
+    vector<vector<Typhoon>> parsed(chunks.size());
+    vector<StringArena> unquoted(chunks.size());
+    vector<vector<LoadWarning>> warnings(chunks.size());
+    vector<size_t> lineCounts(chunks.size());
+    parallelChunks(chunks.size(), [&](size_t c) {
+        lineCounts[c] = parseTyphoonLines(data.data() + chunks[c].first, data.data() + chunks[c].second,
+                                          year, c == 0, parsed[c], unquoted[c], warnings[c]);
+    });
+    for (StringArena& chunkText : unquoted) text.adopt(move(chunkText));
+
+    size_t total = typhoons.size();
+    for (const auto& records : parsed) total += records.size();
+    timer.addItems(total - typhoons.size());
+    typhoons.reserve(total);
+    size_t firstLine = 0;
+    for (size_t c = 0; c < chunks.size(); ++c) {
+        for (const LoadWarning& w : warnings[c]) {
+            cerr << "Warning: " << path << ":" << firstLine + w.line << ": " << w.reason << ", record skipped." << endl;
+        }
+        move(parsed[c].begin(), parsed[c].end(), back_inserter(typhoons));
+        firstLine += lineCounts[c];
+    }
+    return true;
+}
+
+// Function to load typhoons for one year from the data file; their text is kept in text
+vector<Typhoon> loadTyphoons(int year, StringArena& text) {
+    vector<Typhoon> typhoons;
+    if (loadTyphoonsFromFile(dataFilePath, year, typhoons, text) && typhoons.empty()) {
+        cout << "Note: No typhoon records found for " << year << "." << endl;
+    }
+    return typhoons;
+}
+
+// ---------------------------------------------------------------------------
+// Binary snapshot archive
+//
+// Layout (all offsets from the start of the file, every section 8-byte aligned):
+//   SnapshotHeader
+//   double   damages[count]
+//   int32_t  year[count], windSpeed[count], casualties[count]
+//   uint32_t stringOffsets[SNAPSHOT_STRING_FIELDS][count + 1]   (into the pool)
+//   char     stringPool[poolSize]
+// The file is written once from the loaded records and opened read-only with mmap,
+// so opening only checks the section bounds and the end of each string field, whatever the size.
+// ---------------------------------------------------------------------------
+
+enum SnapshotStringField {
+    SF_NAME, SF_ARRIVAL, SF_DEPARTURE, SF_MONTH, SF_INTERVAL, SF_STORM_CROSSING,
+    SF_TIME_OF_LANDFALL, SF_DEVELOPED, SF_PATH_TYPE, SF_LEVELS, SF_PLACES_AFFECTED,
+    SNAPSHOT_STRING_FIELDS
+};
+
+const char SNAPSHOT_MAGIC[8] = {'C', 'L', 'I', 'M', 'A', 'S', 'N', 'P'};
+const uint32_t SNAPSHOT_VERSION = 1;
+const uint32_t SNAPSHOT_BYTE_ORDER = 0x01020304;
+
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint64_t count;
+    uint64_t damagesOffset;
+    uint64_t yearOffset;
+    uint64_t windSpeedOffset;
+    uint64_t casualtiesOffset;
+    uint64_t stringOffsetsOffset;
+    uint64_t poolOffset;
+    uint64_t poolSize;
+};
+
+// Function to get the text member a snapshot field is stored from
+string_view snapshotField(const Typhoon& t, int field) {
+    switch (field) {
+        case SF_NAME: return t.name;
+        case SF_ARRIVAL: return t.arrival;
+        case SF_DEPARTURE: return t.departure;
+        case SF_MONTH: return t.month;
+        case SF_INTERVAL: return t.interval;
+        case SF_STORM_CROSSING: return t.stormCrossing;
+        case SF_TIME_OF_LANDFALL: return t.timeOfLandfall;
+        case SF_DEVELOPED: return t.developed;
+        case SF_PATH_TYPE: return t.pathType;
+        case SF_LEVELS: return t.levels;
+        default: return t.placesAffected;
+    }
+}
+
+uint64_t alignTo8(uint64_t offset) {
+    return (offset + 7) & ~uint64_t(7);
+}
+
+// Function to write loaded typhoons as a binary snapshot; returns false on I/O error
+bool saveSnapshot(const string& path, const vector<Typhoon>& typhoons) {
+    const uint64_t n = typhoons.size();
+    uint64_t poolSize = 0;
+    for (const auto& t : typhoons) {
+        for (int f = 0; f < SNAPSHOT_STRING_FIELDS; ++f) poolSize += snapshotField(t, f).size();
+    }
+    if (poolSize > numeric_limits<uint32_t>::max()) {
+        cout << "Error: Snapshot string pool exceeds 4 GiB." << endl;
+        return false;
+    }
+
+    SnapshotHeader h = {};
+    memcpy(h.magic, SNAPSHOT_MAGIC, sizeof(h.magic));
+    h.version = SNAPSHOT_VERSION;
+    h.byteOrder = SNAPSHOT_BYTE_ORDER;
+    h.count = n;
+    h.damagesOffset = alignTo8(sizeof(SnapshotHeader));
+    h.yearOffset = alignTo8(h.damagesOffset + n * sizeof(double));
+    h.windSpeedOffset = alignTo8(h.yearOffset + n * sizeof(int32_t));
+    h.casualtiesOffset = alignTo8(h.windSpeedOffset + n * sizeof(int32_t));
+    h.stringOffsetsOffset = alignTo8(h.casualtiesOffset + n * sizeof(int32_t));
+    h.poolOffset = alignTo8(h.stringOffsetsOffset + SNAPSHOT_STRING_FIELDS * (n + 1) * sizeof(uint32_t));
+    h.poolSize = poolSize;
+
+    ofstream out(path, ios::binary | ios::trunc);
+    if (!out) {
+        cout << "Error: Cannot create snapshot file '" << path << "'." << endl;
+        return false;
+    }
+    uint64_t written = 0;
+    auto pad = [&](uint64_t offset) {
+        static const char zeros[8] = {};
+        out.write(zeros, offset - written);
+        written = offset;
+    };
+    auto writeRaw = [&](const void* data, uint64_t size) {
+        out.write(static_cast<const char*>(data), size);
+        written += size;
+    };
+
+    writeRaw(&h, sizeof(h));
+    pad(h.damagesOffset);
+    for (const auto& t : typhoons) writeRaw(&t.damages, sizeof(double));
+    pad(h.yearOffset);
+    for (const auto& t : typhoons) { int32_t v = t.year; writeRaw(&v, sizeof(v)); }
+    pad(h.windSpeedOffset);
+    for (const auto& t : typhoons) { int32_t v = t.windSpeed; writeRaw(&v, sizeof(v)); }
+    pad(h.casualtiesOffset);
+    for (const auto& t : typhoons) { int32_t v = t.casualties; writeRaw(&v, sizeof(v)); }
+    pad(h.stringOffsetsOffset);
+    // Each field's strings are stored contiguously so its offsets increase monotonically
+    uint32_t poolPos = 0;
+    for (int f = 0; f < SNAPSHOT_STRING_FIELDS; ++f) {
+        for (const auto& t : typhoons) {
+            writeRaw(&poolPos, sizeof(poolPos));
+            poolPos += snapshotField(t, f).size();
+        }
+        writeRaw(&poolPos, sizeof(poolPos));
+    }
+    pad(h.poolOffset);
+    for (int f = 0; f < SNAPSHOT_STRING_FIELDS; ++f) {
+        for (const auto& t : typhoons) {
+            const string_view s = snapshotField(t, f);
+            writeRaw(s.data(), s.size());
+        }
+    }
+    out.flush();
+    if (!out) {
+        cout << "Error: Failed writing snapshot file '" << path << "'." << endl;
+        return false;
+    }
+    return true;
+}
+
+// Read-only, memory-mapped view of a snapshot file. Numeric columns are used in place;
+// strings are returned as views into the mapped pool.
+class MappedArchive {
+public:
+    MappedArchive() = default;
+    MappedArchive(const MappedArchive&) = delete;
+    MappedArchive& operator=(const MappedArchive&) = delete;
+    ~MappedArchive() { close(); }
+
+    bool open(const string& path);
+    void close();
+    bool isOpen() const { return base != nullptr; }
+
+    size_t size() const { return count; }
+    const double* damages() const { return damagesCol; }
+    const int32_t* years() const { return yearCol; }
+    const int32_t* windSpeeds() const { return windSpeedCol; }
+    const int32_t* casualties() const { return casualtiesCol; }
+
+    // A string whose offsets are out of order or past the pool (a corrupt file) reads as empty;
+    // open only checks each field's last offset, so its cost does not grow with the archive
+    string_view field(int f, size_t i) const {
+        const uint32_t* offs = stringOffsets + f * (count + 1);
+        if (offs[i] > offs[i + 1] || offs[i + 1] > poolSize) return string_view();
+        return string_view(pool + offs[i], offs[i + 1] - offs[i]);
+    }
+    string_view name(size_t i) const { return field(SF_NAME, i); }
+    string_view pathType(size_t i) const { return field(SF_PATH_TYPE, i); }
+    string_view placesAffected(size_t i) const { return field(SF_PLACES_AFFECTED, i); }
+
+    Typhoon toTyphoon(size_t i) const;
+    vector<Typhoon> loadYear(int year) const;
+
+private:
+    const char* base = nullptr;
+    size_t mappedSize = 0;
+#ifdef _WIN32
+    HANDLE fileHandle = INVALID_HANDLE_VALUE;
+    HANDLE mappingHandle = nullptr;
+#endif
+    size_t count = 0;
+    const double* damagesCol = nullptr;
+    const int32_t* yearCol = nullptr;
+    const int32_t* windSpeedCol = nullptr;
+    const int32_t* casualtiesCol = nullptr;
+    const uint32_t* stringOffsets = nullptr;
+    const char* pool = nullptr;
+    uint64_t poolSize = 0;
+};
+
+// Function to check that a section of elems * elemSize bytes at offset is aligned and lies
+// inside a file of fileSize bytes, without overflowing on corrupt header values
+bool snapshotSectionFits(uint64_t offset, uint64_t elems, uint64_t elemSize, uint64_t fileSize) {
+    if (offset % 8 != 0 || offset < sizeof(SnapshotHeader) || offset > fileSize) return false;
+    return elems <= (fileSize - offset) / elemSize;
+}
+
+// Function to check that every section a snapshot header describes lies inside the file
+bool snapshotSectionsFit(const SnapshotHeader& h, uint64_t fileSize) {
+    // count + 1 offsets per string field must not overflow either
+    if (h.count >= fileSize) return false;
+    return snapshotSectionFits(h.damagesOffset, h.count, sizeof(double), fileSize)
+        && snapshotSectionFits(h.yearOffset, h.count, sizeof(int32_t), fileSize)
+        && snapshotSectionFits(h.windSpeedOffset, h.count, sizeof(int32_t), fileSize)
+        && snapshotSectionFits(h.casualtiesOffset, h.count, sizeof(int32_t), fileSize)
+        && snapshotSectionFits(h.stringOffsetsOffset, SNAPSHOT_STRING_FIELDS * (h.count + 1),
+                               sizeof(uint32_t), fileSize)
+        && h.poolOffset <= fileSize && h.poolSize <= fileSize - h.poolOffset;
+}
+
+// Function to check that each string field ends inside the pool. The offsets of single rows are
+// checked when a row is read (MappedArchive::field), so opening stays independent of the row count.
+bool snapshotOffsetsValid(const SnapshotHeader& h, const char* base) {
+    const uint32_t* offsets = reinterpret_cast<const uint32_t*>(base + h.stringOffsetsOffset);
+    for (int f = 0; f < SNAPSHOT_STRING_FIELDS; ++f) {
+        if (offsets[f * (h.count + 1) + h.count] > h.poolSize) return false;
+    }
+    return true;
+}
+
+bool MappedArchive::open(const string& path) {
+    ScopedTimer timer(STAT_OPEN_SNAPSHOT);
+    close();
+#ifdef _WIN32
+    fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                             OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE) {
+        cout << "Error: Cannot open snapshot file '" << path << "'." << endl;
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    GetFileSizeEx(fileHandle, &fileSize);
+    mappedSize = static_cast<size_t>(fileSize.QuadPart);
+    if (mappedSize >= sizeof(SnapshotHeader)) {
+        mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingHandle) base = static_cast<const char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+    }
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        cout << "Error: Cannot open snapshot file '" << path << "'." << endl;
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= sizeof(SnapshotHeader)) {
+        mappedSize = st.st_size;
+        void* p = mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED) base = static_cast<const char*>(p);
+    }
+    ::close(fd);
+#endif
+    if (!base) {
+        cout << "Error: Cannot map snapshot file '" << path << "'." << endl;
+        close();
+        return false;
+    }
+
+    const SnapshotHeader* h = reinterpret_cast<const SnapshotHeader*>(base);
+    bool valid = memcmp(h->magic, SNAPSHOT_MAGIC, sizeof(h->magic)) == 0
+              && h->version == SNAPSHOT_VERSION
+              && h->byteOrder == SNAPSHOT_BYTE_ORDER
+              && snapshotSectionsFit(*h, mappedSize)
+              && snapshotOffsetsValid(*h, base);
+    if (!valid) {
+        cout << "Error: '" << path << "' is not a valid ClimaScope snapshot." << endl;
+        close();
+        return false;
+    }
+    count = h->count;
+    damagesCol = reinterpret_cast<const double*>(base + h->damagesOffset);
+    yearCol = reinterpret_cast<const int32_t*>(base + h->yearOffset);
+    windSpeedCol = reinterpret_cast<const int32_t*>(base + h->windSpeedOffset);
+    casualtiesCol = reinterpret_cast<const int32_t*>(base + h->casualtiesOffset);
+    stringOffsets = reinterpret_cast<const uint32_t*>(base + h->stringOffsetsOffset);
+    pool = base + h->poolOffset;
+    poolSize = h->poolSize;
+    timer.addItems(count);
+    return true;
+}
+
+void MappedArchive::close() {
+#ifdef _WIN32
+    if (base) UnmapViewOfFile(base);
+    if (mappingHandle) CloseHandle(mappingHandle);
+    if (fileHandle != INVALID_HANDLE_VALUE) CloseHandle(fileHandle);
+    mappingHandle = nullptr;
+    fileHandle = INVALID_HANDLE_VALUE;
+#else
+    if (base) munmap(const_cast<char*>(base), mappedSize);
+#endif
+    base = nullptr;
+    mappedSize = 0;
+    count = 0;
+}
+
+// Function to materialize one mapped record as a Typhoon; its text stays in the mapping
+Typhoon MappedArchive::toTyphoon(size_t i) const {
+    Typhoon t;
+    t.year = yearCol[i];
+    t.name = field(SF_NAME, i);
+    t.arrival = field(SF_ARRIVAL, i);
+    t.departure = field(SF_DEPARTURE, i);
+    t.month = field(SF_MONTH, i);
+    t.interval = field(SF_INTERVAL, i);
+    t.stormCrossing = field(SF_STORM_CROSSING, i);
+    t.timeOfLandfall = field(SF_TIME_OF_LANDFALL, i);
+    t.developed = field(SF_DEVELOPED, i);
+    t.pathType = field(SF_PATH_TYPE, i);
+    t.levels = field(SF_LEVELS, i);
+    t.windSpeed = windSpeedCol[i];
+    t.casualties = casualtiesCol[i];
+    t.damages = damagesCol[i];
+    t.placesAffected = field(SF_PLACES_AFFECTED, i);
+    parseTimestamps(t);
+    return t;
+}
+
+// Function to materialize only the records of one year
+vector<Typhoon> MappedArchive::loadYear(int year) const {
+    vector<Typhoon> typhoons;
+    for (size_t i = 0; i < count; ++i) {
+        if (yearCol[i] == year) typhoons.push_back(toTyphoon(i));
+    }
+    return typhoons;
+}
+
+// Function to lower-case text and collapse runs of whitespace into single spaces
+string normalizedLower(string_view text) {
+    string out;
+    out.reserve(text.size());
+    for (char c : text) {
+        if (isspace(static_cast<unsigned char>(c))) {
+            if (!out.empty() && out.back() != ' ') out.push_back(' ');
+        } else {
+            out.push_back(static_cast<char>(tolower(static_cast<unsigned char>(c))));
+        }
+    }
+    if (!out.empty() && out.back() == ' ') out.pop_back();
+    return out;
+}
+
+// Function to canonicalize a storm crossing ("land", "LAND " -> "Land")
+string canonicalCrossing(string_view text) {
+    string key = normalizedLower(text);
+    if (key == "land") return "Land";
+    if (key == "water") return "Water";
+    return string(text);
+}
+
+// Function to canonicalize where a storm developed ("Within the PAR" -> "WITHIN THE PAR")
+string canonicalDeveloped(string_view text) {
+    string key = normalizedLower(text);
+    if (key == "within the par" || key == "inside the par") return "WITHIN THE PAR";
+    if (key == "outside the par") return "OUTSIDE THE PAR";
+    return string(text);
+}
+
+// Function to canonicalize a storm level, including known misspellings in the archive
+string canonicalLevel(string_view text) {
+    static const map<string, string> levelMap = {
+        {"tropical depression", "Tropical Depression"}, {"tropical depresion", "Tropical Depression"},
+        {"td", "Tropical Depression"},
+        {"tropical storm", "Tropical Storm"}, {"ts", "Tropical Storm"},
+        {"severe tropical storm", "Severe Tropical Storm"}, {"severe typhoon storm", "Severe Tropical Storm"},
+        {"sts", "Severe Tropical Storm"},
+        {"typhoon", "Typhoon"}, {"typoon", "Typhoon"}, {"ty", "Typhoon"},
+        {"super typhoon", "Super Typhoon"}, {"super typoon", "Super Typhoon"}, {"sty", "Super Typhoon"}
+    };
+    auto it = levelMap.find(normalizedLower(text));
+    return it != levelMap.end() ? it->second : string(text);
+}
+
+// Function to canonicalize a path type: title-case each direction word, join hyphenated
+// parts without spaces and repair the "-ard" misspelling ("West - northwestard" -> "West-Northwestward")
+string canonicalPathType(string_view text) {
+    string key = normalizedLower(text);
+    string out;
+    out.reserve(key.size() + 2);
+    size_t i = 0;
+    while (i < key.size()) {
+        if (key[i] == ' ' || key[i] == '-') {
+            bool hyphen = false;
+            while (i < key.size() && (key[i] == ' ' || key[i] == '-')) hyphen |= key[i++] == '-';
+            if (!out.empty() && i < key.size()) out.push_back(hyphen ? '-' : ' ');
+            continue;
+        }
+        size_t j = i;
+        while (j < key.size() && key[j] != ' ' && key[j] != '-') ++j;
+        string word = key.substr(i, j - i);
+        if (word.size() > 3 && word.compare(word.size() - 3, 3, "ard") == 0 && word[word.size() - 4] != 'w') {
+            word.insert(word.size() - 3, "w");
+        }
+        if (word != "to") word[0] = static_cast<char>(toupper(static_cast<unsigned char>(word[0])));
+        out += word;
+        i = j;
+    }
+    return out;
+}
+
+// Philippine regions, each followed by its provinces in PSGC order. Seeding the place
+// dictionary with this list fixes the display order and keeps the common codes stable.
+const char* const PLACE_SEED[] = {
+    "Region I", "Ilocos Norte", "Ilocos Sur", "La Union", "Pangasinan",
+    "CAR", "Abra", "Apayao", "Benguet", "Ifugao", "Kalinga", "Mountain Province",
+    "Region II", "Batanes", "Cagayan", "Isabela", "Nueva Vizcaya", "Quirino",
+    "Region III", "Aurora", "Bataan", "Bulacan", "Nueva Ecija", "Pampanga", "Tarlac", "Zambales",
+    "NCR",
+    "Region IV-A", "Batangas", "Cavite", "Laguna", "Quezon", "Rizal",
+    "Region IV-B", "Marinduque", "Occidental Mindoro", "Oriental Mindoro", "Palawan", "Romblon",
+    "Region V", "Albay", "Camarines Norte", "Camarines Sur", "Catanduanes", "Masbate", "Sorsogon",
+    "Region VI", "Aklan", "Antique", "Capiz", "Guimaras", "Iloilo", "Negros Occidental",
+    "Region VII", "Bohol", "Cebu", "Negros Oriental", "Siquijor",
+    "Region VIII", "Biliran", "Eastern Samar", "Leyte", "Northern Samar", "Samar", "Southern Leyte",
+    "Region IX", "Zamboanga del Norte", "Zamboanga del Sur", "Zamboanga Sibugay",
+    "Region X", "Bukidnon", "Camiguin", "Lanao del Norte", "Misamis Occidental", "Misamis Oriental",
+    "Region XI", "Davao de Oro", "Davao del Norte", "Davao del Sur", "Davao Occidental", "Davao Oriental",
+    "Region XII", "Cotabato", "Sarangani", "South Cotabato", "Sultan Kudarat",
+    "Region XIII", "Agusan del Norte", "Agusan del Sur", "Dinagat Islands", "Surigao del Norte", "Surigao del Sur",
+    "BARMM", "Basilan", "Lanao del Sur", "Maguindanao del Norte", "Maguindanao del Sur", "Sulu", "Tawi-Tawi"
+};
+
+// Other spellings found in bulletins, mapped to the seeded names (lower-case keys)
+const map<string, vector<string>>& placeAliases() {
+    static const map<string, vector<string>> aliases = {
+        {"ilocos region", {"Region I"}}, {"cordillera administrative region", {"CAR"}},
+        {"cagayan valley", {"Region II"}}, {"central luzon", {"Region III"}},
+        {"metro manila", {"NCR"}}, {"national capital region", {"NCR"}},
+        {"calabarzon", {"Region IV-A"}}, {"mimaropa", {"Region IV-B"}}, {"iv-b", {"Region IV-B"}},
+        {"bicol", {"Region V"}}, {"bicol region", {"Region V"}}, {"bicol region (general)", {"Region V"}},
+        {"western visayas", {"Region VI"}}, {"central visayas", {"Region VII"}},
+        {"eastern visayas", {"Region VIII"}}, {"zamboanga peninsula", {"Region IX"}},
+        {"northern mindanao", {"Region X"}}, {"davao region", {"Region XI"}},
+        {"soccsksargen", {"Region XII"}}, {"caraga", {"Region XIII"}},
+        {"dinagat island", {"Dinagat Islands"}}, {"mindoro", {"Occidental Mindoro", "Oriental Mindoro"}},
+        {"lanao", {"Lanao del Norte", "Lanao del Sur"}},
+        {"northern quezon", {"Quezon"}}, {"northern nueva ecija", {"Nueva Ecija"}},
+        {"northern ilocos norte", {"Ilocos Norte"}}, {"polillo islands", {"Quezon"}},
+        {"babuyan islands", {"Cagayan"}}, {"baguio city", {"Benguet"}}, {"bayombong", {"Nueva Vizcaya"}},
+        {"sinait", {"Ilocos Sur"}}, {"butuan city", {"Agusan del Norte"}}
+    };
+    return aliases;
+}
+
+Dictionary<uint16_t> seededPlaceDictionary() {
+    Dictionary<uint16_t> dict{""};
+    for (const char* place : PLACE_SEED) dict.intern(place);
+    return dict;
+}
+
+// Function to split a pipe/slash separated placesAffected string into trimmed tokens
+template <typename Visit>
+void forEachPlaceToken(string_view text, Visit visit) {
+    size_t start = 0;
+    int depth = 0;
+    for (size_t i = 0; i <= text.size(); ++i) {
+        char c = i < text.size() ? text[i] : '|';
+        if (c == '(') ++depth;
+        if (c == ')' && depth > 0) --depth;
+        if (depth == 0 && (c == '|' || c == '/')) {
+            size_t b = start, e = i;
+            while (b < e && isspace(static_cast<unsigned char>(text[b]))) ++b;
+            while (e > b && isspace(static_cast<unsigned char>(text[e - 1]))) --e;
+            if (b < e) visit(text.substr(b, e - b));
+            start = i + 1;
+        }
+    }
+}
+
+// Function to resolve one place token to canonical province/region names. Town details are
+// dropped: "Albay (Legazpi, Tabaco)" -> Albay, "Baler, Aurora" -> Aurora. Returns false when the
+// token names no seeded province or region ("Southern Luzon"); out is then empty.
+bool canonicalPlaces(string_view token, vector<string>& out) {
+    static const map<string, string> seeded = [] {
+        map<string, string> m;
+        for (const char* place : PLACE_SEED) m.emplace(normalizedLower(place), place);
+        return m;
+    }();
+    out.clear();
+    string key = normalizedLower(token);
+    if (key.empty() || key.compare(0, 14, "no significant") == 0) return true;
+
+    auto alias = placeAliases().find(key);
+    if (alias != placeAliases().end()) { out = alias->second; return true; }
+    size_t paren = key.find('(');
+    if (paren != string::npos) {
+        key = normalizedLower(key.substr(0, paren));
+        alias = placeAliases().find(key);
+        if (alias != placeAliases().end()) { out = alias->second; return true; }
+    }
+    size_t comma = key.rfind(',');
+    if (comma != string::npos) key = normalizedLower(key.substr(comma + 1));
+
+    auto it = seeded.find(key);
+    if (it != seeded.end()) { out.push_back(it->second); return true; }
+    alias = placeAliases().find(key);
+    if (alias != placeAliases().end()) { out = alias->second; return true; }
+    return false;
+}
+
+void TyphoonTable::markPlace(size_t i, uint16_t code) {
+    if (code >= placeWords * 64) {
+        // Dictionary outgrew the row width: re-stride every row with a doubled width
+        size_t newWords = placeWords * 2;
+        while (code >= newWords * 64) newWords *= 2;
+        vector<uint64_t> wider(size() * newWords, 0);
+        for (size_t r = 0; r < size(); ++r) {
+            copy(placeBits.begin() + r * placeWords, placeBits.begin() + (r + 1) * placeWords,
+                 wider.begin() + r * newWords);
+        }
+        placeBits.swap(wider);
+        placeWords = newWords;
+    }
+    placeBits[i * placeWords + code / 64] |= uint64_t(1) << (code % 64);
+}
+
+// Function to compute how long a storm stayed in the PAR, rounded to the hour. Uses the parsed
+// arrival/departure times and falls back to the interval column (days) only when those are
+// missing. Returns -1 when neither gives a valid, non-negative duration.
+int32_t computeStayHours(const Typhoon& t) {
+    if (t.arrivalTime != NO_TIMESTAMP && t.departureTime != NO_TIMESTAMP) {
+        int32_t minutes = t.departureTime - t.arrivalTime;
+        return minutes >= 0 ? (minutes + 30) / 60 : -1;
+    }
+    int days;
+    const char* b = t.interval.data();
+    if (!t.interval.empty() && parseNumber(b, b + t.interval.size(), days) && days >= 0) return days * 24;
+    return -1;
+}
+
+void TyphoonTable::reserve(size_t n) {
+    year.reserve(n);
+    monthNumber.reserve(n);
+    windSpeed.reserve(n);
+    casualties.reserve(n);
+    damages.reserve(n);
+    arrivalTime.reserve(n);
+    departureTime.reserve(n);
+    landfallTime.reserve(n);
+    stayHours.reserve(n);
+    stormCrossing.reserve(n);
+    developed.reserve(n);
+    levels.reserve(n);
+    pathType.reserve(n);
+    placeBits.reserve(n * placeWords);
+    for (vector<string_view>* col :
+         {&name, &arrival, &departure, &month, &interval, &timeOfLandfall, &placesAffected}) {
+        col->reserve(n);
+    }
+}
+
+// Function to grow (or shrink) every column to n rows; new rows are zeroed
+void TyphoonTable::resizeRows(size_t n) {
+    year.resize(n);
+    monthNumber.resize(n);
+    windSpeed.resize(n);
+    casualties.resize(n);
+    damages.resize(n);
+    arrivalTime.resize(n);
+    departureTime.resize(n);
+    landfallTime.resize(n);
+    stayHours.resize(n);
+    stormCrossing.resize(n);
+    developed.resize(n);
+    levels.resize(n);
+    pathType.resize(n);
+    placeBits.resize(n * placeWords, 0);
+    for (vector<string_view>* col :
+         {&name, &arrival, &departure, &month, &interval, &timeOfLandfall, &placesAffected}) {
+        col->resize(n);
+    }
+}
+
+// Function to write a record into row i, copying the text the columns keep into the table's
+// arena. Text equal to what the row already holds is not copied again.
+void TyphoonTable::setRow(size_t i, const Typhoon& t) {
+    year[i] = t.year;
+    monthNumber[i] = static_cast<unsigned char>(getMonthInt(t.month));
+    windSpeed[i] = t.windSpeed;
+    casualties[i] = t.casualties;
+    damages[i] = t.damages;
+    arrivalTime[i] = t.arrivalTime;
+    departureTime[i] = t.departureTime;
+    landfallTime[i] = t.landfallTime;
+    stayHours[i] = computeStayHours(t);
+    auto setText = [this](string_view& column, string_view value) {
+        if (column != value) column = text.store(value);
+    };
+    setText(name[i], t.name);
+    setText(arrival[i], t.arrival);
+    setText(departure[i], t.departure);
+    setText(month[i], t.month);
+    setText(interval[i], t.interval);
+    setText(timeOfLandfall[i], t.timeOfLandfall);
+    stormCrossing[i] = crossingNames.intern(canonicalCrossing(t.stormCrossing));
+    developed[i] = developedNames.intern(canonicalDeveloped(t.developed));
+    levels[i] = levelNames.intern(canonicalLevel(t.levels));
+    pathType[i] = pathTypeNames.intern(canonicalPathType(t.pathType));
+    fill(placeBits.begin() + i * placeWords, placeBits.begin() + (i + 1) * placeWords, 0);
+    forEachPlaceToken(placesAffected[i], [&](string_view token) {
+        if (!placeTokenCodes(token).resolved) --unresolvedPlaces;
+    });
+    setText(placesAffected[i], t.placesAffected);
+    forEachPlaceToken(placesAffected[i], [&](string_view token) {
+        const PlaceTokenCodes& place = placeTokenCodes(token);
+        if (!place.resolved) ++unresolvedPlaces;
+        for (uint16_t code : place.codes) markPlace(i, code);
+    });
+}
+
+// Function to look up the place codes of a token of this table's placesAffected text, resolving
+// it with canonicalPlaces the first time the table sees it
+const PlaceTokenCodes& TyphoonTable::placeTokenCodes(string_view token) {
+    auto found = resolvedPlaceTokens.find(token);
+    if (found != resolvedPlaceTokens.end()) return found->second;
+    vector<string> places;
+    PlaceTokenCodes resolved;
+    resolved.resolved = canonicalPlaces(token, places);
+    for (const string& place : places) resolved.codes.push_back(placeNames.intern(place));
+    return resolvedPlaceTokens.emplace(token, move(resolved)).first->second;
+}
+
+// Function to append one record, copying the text the columns keep into the table's arena
+void TyphoonTable::append(Typhoon&& t) {
+    const size_t i = size();
+    resizeRows(i + 1);
+    setRow(i, t);
+}
+
+// Function to intern every value of another dictionary, returning its code -> our code map
+template <typename Code>
+vector<Code> internAll(Dictionary<Code>& dict, const Dictionary<Code>& from) {
+    vector<Code> recode;
+    recode.reserve(from.values.size());
+    for (const string& value : from.values) recode.push_back(dict.intern(value));
+    return recode;
+}
+
+// Function to move every row of another table onto the end of this one, re-coding its interned
+// columns and place bits into this table's dictionaries. Stitching tables built from consecutive
+// chunks in order gives the same codes as appending their records one by one.
+void TyphoonTable::appendTable(TyphoonTable&& part) {
+    const size_t base = size();
+    const size_t n = part.size();
+    auto moveColumn = [](auto& to, auto& from) {
+        to.insert(to.end(), make_move_iterator(from.begin()), make_move_iterator(from.end()));
+    };
+    moveColumn(year, part.year);
+    moveColumn(monthNumber, part.monthNumber);
+    moveColumn(windSpeed, part.windSpeed);
+    moveColumn(casualties, part.casualties);
+    moveColumn(damages, part.damages);
+    moveColumn(arrivalTime, part.arrivalTime);
+    moveColumn(departureTime, part.departureTime);
+    moveColumn(landfallTime, part.landfallTime);
+    moveColumn(stayHours, part.stayHours);
+    moveColumn(name, part.name);
+    moveColumn(arrival, part.arrival);
+    moveColumn(departure, part.departure);
+    moveColumn(month, part.month);
+    moveColumn(interval, part.interval);
+    moveColumn(timeOfLandfall, part.timeOfLandfall);
+    moveColumn(placesAffected, part.placesAffected);
+    text.adopt(move(part.text));
+    unresolvedPlaces += part.unresolvedPlaces;
+
+    auto recodeColumn = [n](auto& to, const auto& from, const auto& recode) {
+        for (size_t i = 0; i < n; ++i) to.push_back(recode[from[i]]);
+    };
+    recodeColumn(stormCrossing, part.stormCrossing, internAll(crossingNames, part.crossingNames));
+    recodeColumn(developed, part.developed, internAll(developedNames, part.developedNames));
+    recodeColumn(levels, part.levels, internAll(levelNames, part.levelNames));
+    recodeColumn(pathType, part.pathType, internAll(pathTypeNames, part.pathTypeNames));
+
+    vector<uint16_t> placeCodes = internAll(placeNames, part.placeNames);
+    bool samePlaceCodes = part.placeWords == placeWords;
+    for (size_t c = 0; samePlaceCodes && c < placeCodes.size(); ++c) samePlaceCodes = placeCodes[c] == c;
+    if (samePlaceCodes) {
+        moveColumn(placeBits, part.placeBits);
+    } else {
+        placeBits.resize(size() * placeWords, 0);
+        for (size_t i = 0; i < n; ++i) {
+            const uint64_t* bits = part.placeRow(i);
+            for (size_t w = 0; w < part.placeWords; ++w) {
+                for (uint64_t word = bits[w]; word; word &= word - 1) {
+                    markPlace(base + i, placeCodes[w * 64 + countTrailingZeros(word)]);
+                }
+            }
+        }
+    }
+    part = TyphoonTable();
+}
+
+// Function to build the (year, month) index with a counting sort; rows keep their load order
+// within each month
+void TyphoonTable::buildMonthIndex() {
+    ScopedTimer timer(STAT_BUILD_MONTH_INDEX);
+    timer.addItems(size());
+    monthIndexStart.clear();
+    monthIndexRows.clear();
+    indexYears.clear();
+    const uint64_t version = ++tableVersionClock;
+    fill(begin(columnVersion), end(columnVersion), version);
+    bucketVersion.clear();
+    if (empty()) return;
+
+    // Rows of one year are usually adjacent, so skipping repeats leaves only a few years to sort
+    for (size_t i = 0; i < size(); ++i) {
+        if (indexYears.empty() || indexYears.back() != year[i]) indexYears.push_back(year[i]);
+    }
+    sort(indexYears.begin(), indexYears.end());
+    indexYears.erase(unique(indexYears.begin(), indexYears.end()), indexYears.end());
+    const size_t buckets = indexYears.size() * 13;
+    vector<uint32_t> rowBucket(size());
+    monthIndexStart.assign(buckets + 1, 0);
+    for (size_t i = 0; i < size(); ++i) {
+        rowBucket[i] = uint32_t(bucketOf(i));
+        ++monthIndexStart[rowBucket[i] + 1];
+    }
+    for (size_t b = 0; b < buckets; ++b) monthIndexStart[b + 1] += monthIndexStart[b];
+    monthIndexRows.resize(size());
+    vector<uint32_t> next(monthIndexStart.begin(), monthIndexStart.end() - 1);
+    for (size_t i = 0; i < size(); ++i) monthIndexRows[next[rowBucket[i]]++] = uint32_t(i);
+    bucketVersion.assign(buckets, version);
+}
+
+// Function to split a storm name into its local and international parts: "Kristine (Trami)" and
+// "Kristine/Trami" -> "Kristine", "Trami". Other names have no international part.
+void splitStormName(string_view name, string_view& local, string_view& international) {
+    auto trim = [](string_view text) {
+        while (!text.empty() && isspace(static_cast<unsigned char>(text.front()))) text.remove_prefix(1);
+        while (!text.empty() && isspace(static_cast<unsigned char>(text.back()))) text.remove_suffix(1);
+        return text;
+    };
+    const size_t split = name.find_first_of("(/");
+    local = trim(name.substr(0, split));
+    international = string_view();
+    if (split == string_view::npos) return;
+    string_view rest = name.substr(split + 1);
+    if (name[split] == '(') rest = rest.substr(0, rest.find(')'));
+    international = trim(rest);
+}
+
+// Function to build the name index: one folded key per local and international name, sorted so
+// lookups are binary searches and the A-Z listing is a walk
+void TyphoonTable::buildNameIndex() {
+    ScopedTimer timer(STAT_BUILD_NAME_INDEX);
+    timer.addItems(size());
+    nameIndex.clear();
+    nameIndex.reserve(size());
+    for (size_t i = 0; i < size(); ++i) {
+        string_view local, international;
+        splitStormName(name[i], local, international);
+        nameIndex.push_back({text.store(normalizedLower(local)), uint32_t(i), false});
+        if (!international.empty()) {
+            nameIndex.push_back({text.store(normalizedLower(international)), uint32_t(i), true});
+        }
+    }
+    sort(nameIndex.begin(), nameIndex.end(), [this](const NameKey& a, const NameKey& b) {
+        return nameKeyBefore(a, b);
+    });
+}
+
+// Name index order: key, then displayed name, then row
+bool TyphoonTable::nameKeyBefore(const NameKey& a, const NameKey& b) const {
+    if (a.key != b.key) return a.key < b.key;
+    if (name[a.row] != name[b.row]) return name[a.row] < name[b.row];
+    return a.row < b.row;
+}
+
+// Function to add row i to its (year, month) bucket, keeping rows in load order. A year the index
+// does not have yet rebuilds the index instead.
+void TyphoonTable::indexMonth(size_t i) {
+    if (yearSlot(year[i]) < 0) {
+        buildMonthIndex();
+        return;
+    }
+    const size_t bucket = bucketOf(i);
+    auto first = monthIndexRows.begin() + monthIndexStart[bucket];
+    auto last = monthIndexRows.begin() + monthIndexStart[bucket + 1];
+    monthIndexRows.insert(upper_bound(first, last, uint32_t(i)), uint32_t(i));
+    for (size_t b = bucket + 1; b < monthIndexStart.size(); ++b) ++monthIndexStart[b];
+}
+
+// Function to take row i out of its (year, month) bucket
+void TyphoonTable::unindexMonth(size_t i) {
+    const size_t bucket = bucketOf(i);
+    auto first = monthIndexRows.begin() + monthIndexStart[bucket];
+    auto last = monthIndexRows.begin() + monthIndexStart[bucket + 1];
+    auto it = lower_bound(first, last, uint32_t(i));
+    if (it == last || *it != i) return;
+    monthIndexRows.erase(it);
+    for (size_t b = bucket + 1; b < monthIndexStart.size(); ++b) --monthIndexStart[b];
+}
+
+// Function to add row i's local and international name keys at their sorted positions
+void TyphoonTable::indexName(size_t i) {
+    string_view local, international;
+    splitStormName(name[i], local, international);
+    auto insertKey = [&](string_view part, bool isInternational) {
+        const NameKey entry{text.store(normalizedLower(part)), uint32_t(i), isInternational};
+        auto at = upper_bound(nameIndex.begin(), nameIndex.end(), entry, [this](const NameKey& a, const NameKey& b) {
+            return nameKeyBefore(a, b);
+        });
+        nameIndex.insert(at, entry);
+    };
+    insertKey(local, false);
+    if (!international.empty()) insertKey(international, true);
+}
+
+// Function to remove row i's name keys; call before the row's name changes
+void TyphoonTable::unindexName(size_t i) {
+    string_view local, international;
+    splitStormName(name[i], local, international);
+    auto eraseKey = [&](string_view part) {
+        const string key = normalizedLower(part);
+        const NameKey entry{key, uint32_t(i), false};
+        auto at = lower_bound(nameIndex.begin(), nameIndex.end(), entry, [this](const NameKey& a, const NameKey& b) {
+            return nameKeyBefore(a, b);
+        });
+        if (at != nameIndex.end() && at->row == i && at->key == key) nameIndex.erase(at);
+    };
+    eraseKey(local);
+    if (!international.empty()) eraseKey(international);
+}
+
+// Function to append one record and add it to the month and name indexes. Shifting the index
+// entries after its bucket is the only cost that grows with the table.
+void TyphoonTable::insertRecord(Typhoon&& t) {
+    append(move(t));
+    const size_t i = size() - 1;
+    indexMonth(i);
+    indexName(i);
+    touch(COLUMNS_ALL, bucketOf(i));
+}
+
+// Function to copy a table with its indexes and versions. The copy stores its own text, so it can
+// be changed while readers keep using the original (snapshot copy-on-write).
+TyphoonTable TyphoonTable::clone() const {
+    TyphoonTable copy;
+    copy.id = id;
+    copy.year = year;
+    copy.monthNumber = monthNumber;
+    copy.windSpeed = windSpeed;
+    copy.casualties = casualties;
+    copy.damages = damages;
+    copy.arrivalTime = arrivalTime;
+    copy.departureTime = departureTime;
+    copy.landfallTime = landfallTime;
+    copy.stayHours = stayHours;
+    static vector<string_view> TyphoonTable::* const textColumns[] = {
+        &TyphoonTable::name, &TyphoonTable::arrival, &TyphoonTable::departure,
+        &TyphoonTable::month, &TyphoonTable::interval, &TyphoonTable::timeOfLandfall,
+        &TyphoonTable::placesAffected,
+    };
+    for (vector<string_view> TyphoonTable::* column : textColumns) {
+        (copy.*column).reserve((this->*column).size());
+        for (string_view value : this->*column) (copy.*column).push_back(copy.text.store(value));
+    }
+    copy.stormCrossing = stormCrossing;
+    copy.developed = developed;
+    copy.levels = levels;
+    copy.pathType = pathType;
+    copy.crossingNames = crossingNames;
+    copy.developedNames = developedNames;
+    copy.levelNames = levelNames;
+    copy.pathTypeNames = pathTypeNames;
+    copy.placeNames = placeNames;
+    copy.placeWords = placeWords;
+    copy.placeBits = placeBits;
+    copy.unresolvedPlaces = unresolvedPlaces;
+    copy.indexYears = indexYears;
+    copy.monthIndexStart = monthIndexStart;
+    copy.monthIndexRows = monthIndexRows;
+    copy.nameIndex.reserve(nameIndex.size());
+    for (const NameKey& entry : nameIndex) copy.nameIndex.push_back({copy.text.store(entry.key), entry.row, entry.international});
+    memcpy(copy.columnVersion, columnVersion, sizeof(columnVersion));
+    copy.bucketVersion = bucketVersion;
+    return copy;
+}
+
+// Function to overwrite row i with a new version of its record. The row keeps its number; it
+// moves between month buckets or name index entries only when its month or name changed. Only
+// the column groups whose values differ get a new version. The previous text stays in the arena
+// until the table is dropped.
+void TyphoonTable::replaceRecord(size_t i, Typhoon&& t) {
+    unsigned changed = 0;
+    if (t.name != name[i]) changed |= COLUMNS_NAME;
+    if (t.year != year[i] || t.month != month[i] || t.arrival != arrival[i] || t.departure != departure[i]
+        || t.interval != interval[i] || t.timeOfLandfall != timeOfLandfall[i]) {
+        changed |= COLUMNS_DATES;
+    }
+    if (t.windSpeed != windSpeed[i]) changed |= COLUMNS_WIND;
+    if (t.casualties != casualties[i]) changed |= COLUMNS_CASUALTIES;
+    if (t.damages != damages[i]) changed |= COLUMNS_DAMAGES;
+    if (canonicalCrossing(t.stormCrossing) != stormCrossingText(i) || canonicalDeveloped(t.developed) != developedText(i)
+        || canonicalPathType(t.pathType) != pathTypeText(i) || canonicalLevel(t.levels) != levelsText(i)) {
+        changed |= COLUMNS_CLASS;
+    }
+    const vector<uint64_t> oldPlaces(placeRow(i), placeRow(i) + placeWords);
+
+    const bool moved = t.year != year[i] || getMonthInt(t.month) != monthNumber[i];
+    const bool renamed = (changed & COLUMNS_NAME) != 0;
+    const size_t oldBucket = bucketOf(i);
+    if (moved) unindexMonth(i);
+    if (renamed) unindexName(i);
+    setRow(i, t);
+    if (moved) indexMonth(i);
+    if (renamed) indexName(i);
+
+    for (size_t w = 0; w < placeWords; ++w) {
+        if (placeRow(i)[w] != (w < oldPlaces.size() ? oldPlaces[w] : 0)) {
+            changed |= COLUMNS_PLACES;
+            break;
+        }
+    }
+    if (changed == 0) return;
+    if (moved) touch(0, oldBucket);
+    touch(changed, bucketOf(i));
+}
+
+// Function to give the column groups, and one month index bucket, a new version
+void TyphoonTable::touch(unsigned groups, size_t bucket) {
+    const uint64_t version = ++tableVersionClock;
+    for (int g = 0; g < COLUMN_GROUP_COUNT; ++g) {
+        if (groups & (1u << g)) columnVersion[g] = version;
+    }
+    if (bucket < bucketVersion.size()) bucketVersion[bucket] = version;
+}
+
+// Function to get the latest version of the given column groups; it changes whenever any row's
+// value in one of them changes
+uint64_t TyphoonTable::columnsVersion(unsigned groups) const {
+    uint64_t version = 0;
+    for (int g = 0; g < COLUMN_GROUP_COUNT; ++g) {
+        if (groups & (1u << g)) version = max(version, columnVersion[g]);
+    }
+    return version;
+}
+
+// Function to get the version of the rows of one (year, month); 0 outside the indexed years
+uint64_t TyphoonTable::monthVersion(int recordYear, int recordMonth) const {
+    const long slot = yearSlot(recordYear);
+    if (slot < 0 || recordMonth < 0 || recordMonth > 12) return 0;
+    return bucketVersion[size_t(slot) * 13 + recordMonth];
+}
+
+// Function to rebuild row i as a record to edit
+Typhoon TyphoonTable::record(size_t i) const {
+    Typhoon t;
+    t.year = year[i];
+    t.name = name[i];
+    t.arrival = arrival[i];
+    t.departure = departure[i];
+    t.month = month[i];
+    t.interval = interval[i];
+    t.stormCrossing = stormCrossingText(i);
+    t.timeOfLandfall = timeOfLandfall[i];
+    t.developed = developedText(i);
+    t.pathType = pathTypeText(i);
+    t.levels = levelsText(i);
+    t.windSpeed = windSpeed[i];
+    t.casualties = casualties[i];
+    t.damages = damages[i];
+    t.placesAffected = placesAffected[i];
+    t.arrivalTime = arrivalTime[i];
+    t.departureTime = departureTime[i];
+    t.landfallTime = landfallTime[i];
+    return t;
+}
+
+// Function to find the row of the storm with this local name in the given year, -1 if none.
+// "Kristine (Trami)" and "kristine" name the same storm.
+long TyphoonTable::findRecord(int recordYear, string_view stormName) const {
+    string_view local, international;
+    splitStormName(stormName, local, international);
+    const string key = normalizedLower(local);
+    auto it = lower_bound(nameIndex.begin(), nameIndex.end(), key, [](const NameKey& entry, const string& k) {
+        return entry.key < k;
+    });
+    for (; it != nameIndex.end() && it->key == key; ++it) {
+        if (!it->international && year[it->row] == recordYear) return it->row;
+    }
+    return -1;
+}
+
+// Function to convert loaded records into a columnar table. With several threads, chunks of
+// BUILD_CHUNK_ROWS records are canonicalized into their own tables in parallel and then stitched;
+// pass parallel = false when the caller already runs on a worker thread.
+const size_t BUILD_CHUNK_ROWS = 16384;
+
+TyphoonTable buildTable(vector<Typhoon>&& typhoons, bool parallel) {
+    ScopedTimer timer(STAT_BUILD_TABLE);
+    timer.addItems(typhoons.size());
+    TyphoonTable table;
+    const size_t chunkCount = (typhoons.size() + BUILD_CHUNK_ROWS - 1) / BUILD_CHUNK_ROWS;
+    if (!parallel || threadsFor(chunkCount) <= 1) {
+        table.reserve(typhoons.size());
+        for (auto& t : typhoons) table.append(move(t));
+    } else {
+        vector<TyphoonTable> parts(chunkCount);
+        parallelChunks(chunkCount, [&](size_t c) {
+            const size_t begin = c * BUILD_CHUNK_ROWS, end = min(typhoons.size(), begin + BUILD_CHUNK_ROWS);
+            parts[c].reserve(end - begin);
+            for (size_t i = begin; i < end; ++i) parts[c].append(move(typhoons[i]));
+        });
+        table.reserve(typhoons.size());
+        for (TyphoonTable& part : parts) table.appendTable(move(part));
+    }
+    typhoons.clear();
+    table.buildMonthIndex();
+    table.buildNameIndex();
+    return table;
+}
+
+// Function to look up the rows of one (year, month) bucket of the month index
+RowSpan monthRows(const TyphoonTable& table, int year, int month) {
+    RowSpan rows;
+    const long slot = table.yearSlot(year);
+    if (slot < 0 || month < 1 || month > 12) return rows;
+    const size_t bucket = size_t(slot) * 13 + month;
+    rows.first = table.monthIndexRows.data() + table.monthIndexStart[bucket];
+    rows.last = table.monthIndexRows.data() + table.monthIndexStart[bucket + 1];
+    return rows;
+}
+
+// Function to get typhoons for a specific month and year as a view into the month index. The
+// lookup is only a few loads, so it is timed only when --stats is on.
+RowSpan getTyphoonsForMonth(const TyphoonTable& table, int year, int month) {
+    if (!statsEnabled) return monthRows(table, year, month);
+    ScopedTimer timer(STAT_MONTH_LOOKUP);
+    const RowSpan rows = monthRows(table, year, month);
+    timer.addItems(rows.size());
+    return rows;
+}
+
+// Report output that formats into a reusable buffer and hands it to the stream in large
+// chunks, instead of flushing after every line. The buffer keeps its capacity between reports.
+class ReportWriter {
+public:
+    explicit ReportWriter(ostream& out, size_t flushThreshold = 64 * 1024)
+        : out(out), threshold(flushThreshold) {
+        buffer.reserve(flushThreshold + 4096);
+    }
+    ~ReportWriter() { flush(); }
+
+    ReportWriter& operator<<(const string& text) { buffer += text; return check(); }
+    ReportWriter& operator<<(const char* text) { buffer += text; return check(); }
+    ReportWriter& operator<<(char c) { buffer += c; return check(); }
+    ReportWriter& operator<<(string_view text) { buffer.append(text.data(), text.size()); return check(); }
+    template <typename T, typename = enable_if_t<is_integral_v<T> && !is_same_v<T, char> && !is_same_v<T, bool>>>
+    ReportWriter& operator<<(T value) {
+        char digits[24];
+        auto res = to_chars(digits, digits + sizeof(digits), value);
+        buffer.append(digits, res.ptr - digits);
+        return check();
+    }
+    // Function to append a value with a fixed number of decimals
+    ReportWriter& fixed(double value, int decimals) {
+        char digits[64];
+        int n = snprintf(digits, sizeof(digits), "%.*f", decimals, value);
+        buffer.append(digits, n);
+        return check();
+    }
+    // Function to append a value with two decimals, as the console shows amounts in Peso
+    ReportWriter& money(double value) { return fixed(value, 2); }
+
+    void setThreshold(size_t bytes) { threshold = bytes; }
+    void flush() {
+        if (!buffer.empty()) {
+            out.write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+        out.flush();
+    }
+
+private:
+    ReportWriter& check() {
+        if (buffer.size() >= threshold) {
+            out.write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+        return *this;
+    }
+
+    ostream& out;
+    size_t threshold;
+    string buffer;
+};
+
+// Shared writer for console reports; --report-buffer sets its flush threshold
+ReportWriter consoleReport(cout);
+
+// What a cached result was rendered from: some column groups of a table, or, when month is
+// set, the rows of one (year, month) of its month index. version is the one seen at render time.
+// The table is named by its id, never its address, so a freed table cannot be read through an
+// old entry or mistaken for a new table at the same address.
+struct CacheDependency {
+    uint64_t table;
+    unsigned columns;
+    int year;
+    int month;
+    uint64_t version;
+
+    bool operator==(const CacheDependency& other) const {
+        return table == other.table && columns == other.columns && year == other.year
+            && month == other.month && version == other.version;
+    }
+};
+
+// Function to list the dependencies of a result that reads the given columns of every table
+vector<CacheDependency> datasetDependencies(const TyphoonDataset& dataset, unsigned columns) {
+    vector<CacheDependency> dependencies;
+    dependencies.reserve(dataset.tableCount());
+    for (size_t t = 0; t < dataset.tableCount(); ++t) {
+        const TyphoonTable& table = dataset.table(t);
+        dependencies.push_back({table.id, columns, 0, 0, table.columnsVersion(columns)});
+    }
+    return dependencies;
+}
+
+// Function to build a cache key from a result's name and the tables it reads; a dataset that
+// gains a table gets new keys
+string datasetKey(const string& name, const TyphoonDataset& dataset) {
+    string key = name;
+    for (size_t t = 0; t < dataset.tableCount(); ++t) {
+        key += '|';
+        key += to_string(dataset.table(t).id);
+    }
+    return key;
+}
+
+// Rendered report text of searches, month views and queries, least recently used dropped first
+// once the entries pass the byte capacity (--result-cache <bytes>, 0 turns caching off). An
+// entry is replayed while the caller's dependencies, read from the tables it is answering from,
+// are the ones the entry was rendered from; the cache itself never touches a table.
+class ResultCache {
+public:
+    void setCapacity(size_t bytes) {
+        capacity = bytes;
+        trim();
+    }
+    void clear() {
+        entries.clear();
+        index.clear();
+        bytes = 0;
+    }
+
+    // Function to write a result to report: the cached text when it was rendered from the same
+    // dependencies, else render(out)'s output, which is kept for next time when render returns true
+    template <typename Render>
+    void write(ReportWriter& report, const string& key, vector<CacheDependency>&& dependencies, Render render) {
+        if (capacity == 0) {
+            render(report);
+            return;
+        }
+        auto found = index.find(key);
+        if (found != index.end()) {
+            Entry& entry = *found->second;
+            if (entry.dependencies == dependencies) {
+                ScopedTimer timer(STAT_CACHE_REPLAY);
+                timer.addItems(entry.text.size());
+                entries.splice(entries.begin(), entries, found->second);
+                report << string_view(entry.text);
+                return;
+            }
+            bytes -= entry.key.size() + entry.text.size();
+            entries.erase(found->second);
+            index.erase(found);
+        }
+        ostringstream rendered;
+        bool keep;
+        {
+            ReportWriter out(rendered, 4096);
+            keep = render(out);
+        }
+        const string text = rendered.str();
+        report << text;
+        if (!keep || key.size() + text.size() > capacity) return;
+        entries.push_front({key, text, move(dependencies)});
+        index[key] = entries.begin();
+        bytes += key.size() + text.size();
+        trim();
+    }
+
+private:
+    struct Entry {
+        string key;
+        string text;
+        vector<CacheDependency> dependencies;
+    };
+
+    void trim() {
+        while (bytes > capacity && !entries.empty()) {
+            bytes -= entries.back().key.size() + entries.back().text.size();
+            index.erase(entries.back().key);
+            entries.pop_back();
+        }
+    }
+
+    list<Entry> entries; // most recently used first
+    unordered_map<string, list<Entry>::iterator> index;
+    size_t capacity = 16 << 20;
+    size_t bytes = 0;
+};
+
+ResultCache resultCache;
+
+// Function to format one typhoon's details into a report
+void renderTyphoon(ReportWriter& report, const TyphoonTable& table, size_t i) {
+    report << "Name: " << table.name[i] << '\n';
+    report << "Arrival (PAR): " << table.arrival[i] << '\n';
+    report << "Departure (PAR): " << table.departure[i] << '\n';
+    report << "Month: " << table.month[i] << '\n';
+    report << "Interval: " << table.interval[i] << '\n';
+    report << "Storm Crossing: " << table.stormCrossingText(i) << '\n';
+    report << "Time of Landfall: " << table.timeOfLandfall[i] << '\n';
+    report << "Developed: " << table.developedText(i) << '\n';
+    report << "Path Type: " << table.pathTypeText(i) << '\n';
+    report << "Levels: " << table.levelsText(i) << '\n';
+    report << "Wind Speed: " << table.windSpeed[i] << " km/h\n";
+    report << "Casualties: " << table.casualties[i] << '\n';
+    report << "Damages: ";
+    report.money(table.damages[i]) << " Peso\n";
+    report << "Places Affected: " << table.placesAffected[i] << '\n';
+    report << "----------------------------------------\n";
+}
+
+// Function to format the details of some rows of a table into a report
+void reportRows(ReportWriter& report, const TyphoonTable& table, RowSpan rows) {
+    if (rows.empty()) {
+        report << "No typhoons recorded for this month.\n";
+        return;
+    }
+    for (uint32_t i : rows) {
+        renderTyphoon(report, table, i);
+    }
+}
+
+// Function to display typhoon details; the whole report is written with one flush
+void displayTyphoons(const TyphoonTable& table, RowSpan rows) {
+    ScopedTimer timer(STAT_DISPLAY_TYPHOONS);
+    timer.addItems(rows.size());
+    reportRows(consoleReport, table, rows);
+    consoleReport.flush();
+}
+
+// Function to display the typhoons of one month of a table. The view is kept in the result
+// cache until a storm of that month changes.
+void displayMonth(const TyphoonTable& table, int year, int month) {
+    char key[64];
+    snprintf(key, sizeof(key), "month %d %d|%llu", year, month, static_cast<unsigned long long>(table.id));
+    const CacheDependency rows{table.id, 0, year, month, table.monthVersion(year, month)};
+    resultCache.write(consoleReport, key, {rows}, [&](ReportWriter& out) {
+        const RowSpan monthTyphoons = getTyphoonsForMonth(table, year, month);
+        ScopedTimer timer(STAT_DISPLAY_TYPHOONS);
+        timer.addItems(monthTyphoons.size());
+        reportRows(out, table, monthTyphoons);
+        return true;
+    });
+    consoleReport.flush();
+}
+
+// Function to dump every record of a table in (year, month) order
+void dumpArchive(const TyphoonTable& table) {
+    RowSpan all;
+    all.first = table.monthIndexRows.data();
+    all.last = all.first + table.monthIndexRows.size();
+    for (uint32_t i : all) {
+        renderTyphoon(consoleReport, table, i);
+    }
+    consoleReport.flush();
+}
+
+// Resolutions / recommendations per year: four sections of five points each
+struct ResolutionSection {
+    const char* title;
+    const char* points[5];
+};
+struct YearResolutions {
+    int year;
+    ResolutionSection sections[4];
+};
+const YearResolutions RESOLUTIONS[] = {
+    {2024, {
+        {"Government", {
+            "Increase funding for rapid evacuation systems due to high casualty rates.",
+            "Implement stricter zoning laws in coastal areas affected by multiple typhoons.",
+            "Enhance collaboration with local governments for real-time data sharing.",
+            "Invest in mental health support for disaster survivors.",
+            "Develop national typhoon preparedness campaigns targeting vulnerable populations.",
+        }},
+        {"Community", {
+            "Organize local training sessions on first aid and emergency response.",
+            "Establish community watch groups for early typhoon warnings.",
+            "Promote household emergency kits with focus on food and water storage.",
+            "Foster neighborhood support networks for post-typhoon recovery.",
+            "Encourage sustainable farming practices to reduce environmental vulnerability.",
+        }},
+        {"Improvements", {
+            "Upgrade weather radar systems for better storm tracking accuracy.",
+            "Integrate AI-driven prediction models for casualty minimization.",
+            "Improve data collection on human impacts for future planning.",
+            "Develop mobile apps for personalized evacuation alerts.",
+            "Enhance communication infrastructure to prevent information gaps.",
+        }},
+        {"Advance Preparedness", {
+            "Conduct annual simulation drills in high-risk areas.",
+            "Stockpile medical supplies in advance of typhoon season.",
+            "Train volunteers in search and rescue operations.",
+            "Create digital maps for safe evacuation routes.",
+            "Implement early warning systems in schools and hospitals.",
+        }},
+    }},
+    {2025, {
+        {"Government", {
+            "Allocate budgets for infrastructure repair following extensive damages.",
+            "Enforce building codes with typhoon-resistant materials.",
+            "Partner with international aid for long-term recovery.",
+            "Introduce tax incentives for disaster-resilient construction.",
+            "Establish a national fund for typhoon damage compensation.",
+        }},
+        {"Community", {
+            "Build community shelters with improved durability.",
+            "Educate on insurance options for property protection.",
+            "Promote reforestation to mitigate future storm intensity.",
+            "Organize workshops on damage assessment and reporting.",
+            "Strengthen family emergency plans with focus on economic recovery.",
+        }},
+        {"Improvements", {
+            "Invest in satellite technology for precise damage mapping.",
+            "Develop predictive analytics for economic impact reduction.",
+            "Upgrade communication networks for uninterrupted service.",
+            "Integrate drone technology for rapid post-storm surveys.",
+            "Enhance data analytics for trend analysis in typhoon patterns.",
+        }},
+        {"Advance Preparedness", {
+            "Create regional stockpiles of construction materials.",
+            "Train engineers in quick infrastructure restoration.",
+            "Develop apps for real-time damage reporting.",
+            "Conduct vulnerability assessments annually.",
+            "Establish partnerships with NGOs for sustained support.",
+        }},
+    }},
+};
+
+// Function to find the resolutions of a year, nullptr when there are none
+const YearResolutions* findResolutions(int year) {
+    for (const YearResolutions& resolutions : RESOLUTIONS) {
+        if (resolutions.year == year) return &resolutions;
+    }
+    return nullptr;
+}
+
+// Function to report the resolutions/recommendations of a year
+void reportResolutions(ReportWriter& report, int year) {
+    report << "-- Resolution(s) / Recommendation(s) for " << year << " --\n";
+    const YearResolutions* resolutions = findResolutions(year);
+    if (!resolutions) {
+        report << "No specific resolutions available for this year.\n";
+        return;
+    }
+    for (const ResolutionSection& section : resolutions->sections) {
+        report << "** " << section.title << " **\n";
+        for (const char* point : section.points) report << "- " << point << '\n';
+    }
+}
+
+// Function to display resolutions/recommendations
+void displayResolutions(int year) {
+    reportResolutions(consoleReport, year);
+    consoleReport.flush();
+}
+
+// Function to show the Comments / Menu / Back prompt shared by every search option
+void searchFollowUp(const string& comment) {
+    cout << "1. Comments" << endl;
+    cout << "2. Menu" << endl;
+    cout << "3. Back" << endl;
+    int choice;
+    while (true) {
+        cout << "Enter your choice: ";
+        cin >> choice;
+        if (cin.fail()) {
+            cin.clear();
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+            cout << "Invalid input. Please enter a number." << endl;
+            continue;
+        }
+        if (choice == 1) {
+            cout << "-- Comments --" << endl;
+            cout << comment << endl;
+            cout << "1. Menu" << endl;
+            cout << "2. Back" << endl;
+            cout << "Enter your choice: ";
+            cin >> choice;
+            if (cin.fail()) {
+                cin.clear();
+                cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                continue;
+            }
+            if (choice == 1) break;
+        } else if (choice == 2) {
+            break;
+        } else if (choice == 3) {
+            // Stay in search
+        } else {
+            cout << "Invalid choice." << endl;
+        }
+    }
+}
+
+// Numeric keys the ranking queries can order by
+enum RankKey { RANK_WIND, RANK_CASUALTIES, RANK_DAMAGES, RANK_DURATION };
+
+// One entry of a ranking: the row number and the key it was ranked by
+struct RankedRow {
+    size_t row;
+    double key;
+};
+
+// Bounded selection of the k rows with the largest keys. Rows are offered one at a time, so
+// the caller can walk any number of tables without gathering them first. When k is a large
+// share of the expected rows everything is kept and nth_element picks the winners; otherwise a
+// min-heap of size k holds the best rows so far (O(n log k)). Ties keep the lower row first.
+class TopKSelector {
+public:
+    TopKSelector(size_t k, size_t expectedRows)
+        : limit(min(k, expectedRows)), collectAll(k * 8 >= expectedRows) {
+        ranked.reserve(collectAll ? expectedRows : limit);
+    }
+
+    void offer(size_t row, double key) {
+        if (limit == 0) return;
+        RankedRow candidate = {row, key};
+        if (collectAll) {
+            ranked.push_back(candidate);
+        } else if (ranked.size() < limit) {
+            // better() as the heap order keeps the worst kept row at the front
+            ranked.push_back(candidate);
+            push_heap(ranked.begin(), ranked.end(), better);
+        } else if (better(candidate, ranked.front())) {
+            pop_heap(ranked.begin(), ranked.end(), better);
+            ranked.back() = candidate;
+            push_heap(ranked.begin(), ranked.end(), better);
+        }
+    }
+
+    // Function to return the selected rows, best first
+    vector<RankedRow> finish() {
+        if (collectAll && ranked.size() > limit) {
+            nth_element(ranked.begin(), ranked.begin() + limit, ranked.end(), better);
+            ranked.resize(limit);
+        }
+        sort(ranked.begin(), ranked.end(), better);
+        return move(ranked);
+    }
+
+private:
+    static bool better(const RankedRow& a, const RankedRow& b) {
+        return a.key > b.key || (a.key == b.key && a.row < b.row);
+    }
+
+    size_t limit;
+    bool collectAll;
+    vector<RankedRow> ranked;
+};
+
+// Function to select the k rows with the largest keys among rows [0, n), best first
+template <typename KeyFn>
+vector<RankedRow> topK(size_t n, size_t k, KeyFn key) {
+    TopKSelector selector(k, n);
+    for (size_t i = 0; i < n; ++i) selector.offer(i, double(key(i)));
+    return selector.finish();
+}
+
+// Function to read a ranking key from a table row
+double rankKeyValue(const TyphoonTable& table, size_t i, RankKey key) {
+    switch (key) {
+        case RANK_WIND: return table.windSpeed[i];
+        case RANK_CASUALTIES: return table.casualties[i];
+        case RANK_DAMAGES: return table.damages[i];
+        default: return table.stayHours[i];
+    }
+}
+
+// Parallel scans work on chunks of at most SCAN_CHUNK_ROWS rows of one table
+const size_t SCAN_CHUNK_ROWS = 16384;
+
+struct ScanChunk {
+    size_t table;
+    size_t begin;
+    size_t end;
+};
+
+// Function to cut every table of the dataset into chunks of at most SCAN_CHUNK_ROWS rows
+vector<ScanChunk> chunkDataset(const TyphoonDataset& dataset) {
+    vector<ScanChunk> chunks;
+    for (size_t t = 0; t < dataset.tableCount(); ++t) {
+        const size_t n = dataset.table(t).size();
+        for (size_t begin = 0; begin < n; begin += SCAN_CHUNK_ROWS) {
+            chunks.push_back({t, begin, min(n, begin + SCAN_CHUNK_ROWS)});
+        }
+    }
+    return chunks;
+}
+
+int TyphoonDataset::firstYear() const {
+    int year = numeric_limits<int>::max();
+    for (const TyphoonTable* t : tables) {
+        if (!t->empty()) year = min(year, *min_element(t->year.begin(), t->year.end()));
+    }
+    return year;
+}
+
+int TyphoonDataset::lastYear() const {
+    int year = numeric_limits<int>::min();
+    for (const TyphoonTable* t : tables) {
+        if (!t->empty()) year = max(year, *max_element(t->year.begin(), t->year.end()));
+    }
+    return year;
+}
+
+// Function to count the place names, over all tables, that match no province or region
+size_t TyphoonDataset::unresolvedPlaces() const {
+    size_t count = 0;
+    for (const TyphoonTable* t : tables) count += t->unresolvedPlaces;
+    return count;
+}
+
+// Function to format the "<first> - <last>" year span of a dataset for search headings
+string yearSpan(const TyphoonDataset& dataset) {
+    if (dataset.empty()) return "-";
+    return to_string(dataset.firstYear()) + " - " + to_string(dataset.lastYear());
+}
+
+// Function to rank every row of a dataset by a numeric key; returns dataset-wide row numbers
+vector<RankedRow> rankTyphoons(const TyphoonDataset& dataset, RankKey key, size_t k) {
+    // Each chunk keeps its own top k; the overall top k is among their union
+    vector<ScanChunk> chunks = chunkDataset(dataset);
+    vector<vector<RankedRow>> partial(chunks.size());
+    parallelChunks(chunks.size(), [&](size_t c) {
+        const ScanChunk& chunk = chunks[c];
+        const TyphoonTable& table = dataset.table(chunk.table);
+        const size_t base = dataset.tableOffset(chunk.table);
+        if (k == 1) {
+            // Top 1 is a column maximum: use the vectorized arg-max kernel
+            const size_t n = chunk.end - chunk.begin;
+            size_t best;
+            switch (key) {
+                case RANK_WIND: best = argMax(table.windSpeed.data() + chunk.begin, n); break;
+                case RANK_CASUALTIES: best = argMax(table.casualties.data() + chunk.begin, n); break;
+                case RANK_DAMAGES: best = argMax(table.damages.data() + chunk.begin, n); break;
+                default: best = argMax(table.stayHours.data() + chunk.begin, n); break;
+            }
+            partial[c] = {RankedRow{base + chunk.begin + best, rankKeyValue(table, chunk.begin + best, key)}};
+            return;
+        }
+        TopKSelector selector(k, chunk.end - chunk.begin);
+        for (size_t i = chunk.begin; i < chunk.end; ++i) selector.offer(base + i, rankKeyValue(table, i, key));
+        partial[c] = selector.finish();
+    });
+    if (partial.size() == 1) return move(partial[0]);
+
+    size_t candidates = 0;
+    for (const auto& rows : partial) candidates += rows.size();
+    TopKSelector selector(k, candidates);
+    for (const auto& rows : partial) {
+        for (const RankedRow& r : rows) selector.offer(r.row, r.key);
+    }
+    return selector.finish();
+}
+
+// Query engine. A TyphoonQuery describes predicates plus either a projection (row listing) or a
+// grouping (aggregates). compileQuery resolves it once per table -- dictionary codes, place bit,
+// active bounds -- into a QueryPlan whose steps are plain column scans narrowing a selection
+// vector of row numbers, so no predicate is re-interpreted per record.
+enum QueryField {
+    FIELD_NAME, FIELD_YEAR, FIELD_MONTH, FIELD_WIND, FIELD_CASUALTIES, FIELD_DAMAGES,
+    FIELD_LEVEL, FIELD_CROSSING, FIELD_DEVELOPED, FIELD_STAY, FIELD_PLACES, QUERY_FIELD_COUNT
+};
+const char* const QUERY_FIELD_NAMES[QUERY_FIELD_COUNT] = {
+    "name", "year", "month", "wind", "casualties", "damages", "level", "crossing", "developed", "stay", "places"
+};
+enum GroupBy { GROUP_NONE, GROUP_YEAR, GROUP_MONTH, GROUP_LEVEL, GROUP_REGION };
+
+struct TyphoonQuery {
+    int yearMin = numeric_limits<int>::min();
+    int yearMax = numeric_limits<int>::max();
+    int windMin = numeric_limits<int>::min();
+    int windMax = numeric_limits<int>::max();
+    double damagesMin = -numeric_limits<double>::infinity();
+    double damagesMax = numeric_limits<double>::infinity();
+    string crossing;  // canonical text, empty = any
+    string developed; // canonical text, empty = any
+    string level;     // canonical text, empty = any
+    string place;     // canonical place name, empty = any
+    int32_t arrivalFrom = NO_TIMESTAMP; // inclusive, minutes since epoch
+    int32_t arrivalTo = NO_TIMESTAMP;   // inclusive, minutes since epoch
+    vector<QueryField> fields{FIELD_NAME};
+    GroupBy groupBy = GROUP_NONE;
+};
+
+struct QueryPlan {
+    enum StepKind { STEP_YEAR, STEP_WIND, STEP_DAMAGES, STEP_CROSSING, STEP_DEVELOPED, STEP_LEVEL, STEP_PLACE, STEP_ARRIVAL };
+    struct Step {
+        StepKind kind;
+        int32_t low = 0, high = 0;
+        double lowValue = 0, highValue = 0;
+        uint8_t code = 0;
+        size_t word = 0;
+        uint64_t mask = 0;
+    };
+    vector<Step> steps;
+    bool matchesNothing = false;
+};
+
+// Function to resolve a query against one table's dictionaries and columns
+QueryPlan compileQuery(const TyphoonQuery& query, const TyphoonTable& table) {
+    QueryPlan plan;
+    QueryPlan::Step step;
+    if (query.yearMin != numeric_limits<int>::min() || query.yearMax != numeric_limits<int>::max()) {
+        step.kind = QueryPlan::STEP_YEAR;
+        step.low = query.yearMin;
+        step.high = query.yearMax;
+        plan.steps.push_back(step);
+    }
+    if (query.windMin != numeric_limits<int>::min() || query.windMax != numeric_limits<int>::max()) {
+        step.kind = QueryPlan::STEP_WIND;
+        step.low = query.windMin;
+        step.high = query.windMax;
+        plan.steps.push_back(step);
+    }
+    if (query.damagesMin > -numeric_limits<double>::infinity() || query.damagesMax < numeric_limits<double>::infinity()) {
+        step.kind = QueryPlan::STEP_DAMAGES;
+        step.lowValue = query.damagesMin;
+        step.highValue = query.damagesMax;
+        plan.steps.push_back(step);
+    }
+    auto addCode = [&](QueryPlan::StepKind kind, const Dictionary<uint8_t>& dict, const string& text) {
+        if (text.empty()) return;
+        auto it = dict.codes.find(text);
+        if (it == dict.codes.end()) {
+            plan.matchesNothing = true;
+            return;
+        }
+        step.kind = kind;
+        step.code = it->second;
+        plan.steps.push_back(step);
+    };
+    addCode(QueryPlan::STEP_CROSSING, table.crossingNames, query.crossing);
+    addCode(QueryPlan::STEP_DEVELOPED, table.developedNames, query.developed);
+    addCode(QueryPlan::STEP_LEVEL, table.levelNames, query.level);
+    if (!query.place.empty()) {
+        auto it = table.placeNames.codes.find(query.place);
+        if (it == table.placeNames.codes.end()) {
+            plan.matchesNothing = true;
+        } else {
+            step.kind = QueryPlan::STEP_PLACE;
+            step.word = it->second / 64;
+            step.mask = uint64_t(1) << (it->second % 64);
+            plan.steps.push_back(step);
+        }
+    }
+    if (query.arrivalFrom != NO_TIMESTAMP || query.arrivalTo != NO_TIMESTAMP) {
+        step.kind = QueryPlan::STEP_ARRIVAL;
+        // low stays above NO_TIMESTAMP so rows without an arrival time never match
+        step.low = query.arrivalFrom != NO_TIMESTAMP ? query.arrivalFrom : numeric_limits<int32_t>::min() + 1;
+        step.high = query.arrivalTo != NO_TIMESTAMP ? query.arrivalTo : numeric_limits<int32_t>::max();
+        plan.steps.push_back(step);
+    }
+    return plan;
+}
+
+// Function to keep the selected rows for which keep(row) holds, preserving their order
+template <typename Keep>
+void narrowRows(vector<uint32_t>& rows, Keep keep) {
+    size_t kept = 0;
+    for (size_t i = 0; i < rows.size(); ++i) {
+        const uint32_t r = rows[i];
+        rows[kept] = r;
+        kept += keep(r);
+    }
+    rows.resize(kept);
+}
+
+// Function to run a compiled plan over rows [begin, end) of its table, leaving the matching rows in order
+void executePlan(const QueryPlan& plan, const TyphoonTable& table, size_t begin, size_t end, vector<uint32_t>& rows) {
+    rows.clear();
+    if (plan.matchesNothing) return;
+    const size_t n = end - begin;
+    const uint32_t first = static_cast<uint32_t>(begin);
+    rows.resize(n);
+
+    // The first step selects straight from its column with a vectorized kernel; the rest narrow
+    // the selection. Place bits are strided, so a plan starting with them selects every row first.
+    size_t count = 0, applied = 1;
+    if (plan.steps.empty()) {
+        applied = 0;
+    } else {
+        const QueryPlan::Step& step = plan.steps[0];
+        switch (step.kind) {
+            case QueryPlan::STEP_YEAR:
+                count = selectRange(table.year.data() + begin, n, first, step.low, step.high, rows.data(), 0);
+                break;
+            case QueryPlan::STEP_WIND:
+                count = selectRange(table.windSpeed.data() + begin, n, first, step.low, step.high, rows.data(), 0);
+                break;
+            case QueryPlan::STEP_ARRIVAL:
+                count = selectRange(table.arrivalTime.data() + begin, n, first, step.low, step.high, rows.data(), 0);
+                break;
+            case QueryPlan::STEP_DAMAGES:
+                count = selectRange(table.damages.data() + begin, n, first, step.lowValue, step.highValue, rows.data(), 0);
+                break;
+            case QueryPlan::STEP_CROSSING:
+                count = selectEqual(table.stormCrossing.data() + begin, n, first, step.code, rows.data(), 0);
+                break;
+            case QueryPlan::STEP_DEVELOPED:
+                count = selectEqual(table.developed.data() + begin, n, first, step.code, rows.data(), 0);
+                break;
+            case QueryPlan::STEP_LEVEL:
+                count = selectEqual(table.levels.data() + begin, n, first, step.code, rows.data(), 0);
+                break;
+            default:
+                applied = 0;
+                break;
+        }
+    }
+    if (applied == 0) {
+        for (size_t i = 0; i < n; ++i) rows[i] = first + static_cast<uint32_t>(i);
+        count = n;
+    }
+    rows.resize(count);
+
+    for (size_t s = applied; s < plan.steps.size(); ++s) {
+        const QueryPlan::Step& step = plan.steps[s];
+        const int32_t low = step.low, high = step.high;
+        const uint8_t code = step.code;
+        switch (step.kind) {
+            case QueryPlan::STEP_YEAR: {
+                const int* year = table.year.data();
+                narrowRows(rows, [=](uint32_t r) { return year[r] >= low && year[r] <= high; });
+                break;
+            }
+            case QueryPlan::STEP_WIND: {
+                const int* wind = table.windSpeed.data();
+                narrowRows(rows, [=](uint32_t r) { return wind[r] >= low && wind[r] <= high; });
+                break;
+            }
+            case QueryPlan::STEP_DAMAGES: {
+                const double* damages = table.damages.data();
+                const double lowValue = step.lowValue, highValue = step.highValue;
+                narrowRows(rows, [=](uint32_t r) { return damages[r] >= lowValue && damages[r] <= highValue; });
+                break;
+            }
+            case QueryPlan::STEP_CROSSING: {
+                const uint8_t* crossing = table.stormCrossing.data();
+                narrowRows(rows, [=](uint32_t r) { return crossing[r] == code; });
+                break;
+            }
+            case QueryPlan::STEP_DEVELOPED: {
+                const uint8_t* developed = table.developed.data();
+                narrowRows(rows, [=](uint32_t r) { return developed[r] == code; });
+                break;
+            }
+            case QueryPlan::STEP_LEVEL: {
+                const uint8_t* levels = table.levels.data();
+                narrowRows(rows, [=](uint32_t r) { return levels[r] == code; });
+                break;
+            }
+            case QueryPlan::STEP_PLACE: {
+                const uint64_t* bits = table.placeBits.data() + step.word;
+                const size_t stride = table.placeWords;
+                const uint64_t mask = step.mask;
+                narrowRows(rows, [=](uint32_t r) { return (bits[r * stride] & mask) != 0; });
+                break;
+            }
+            case QueryPlan::STEP_ARRIVAL: {
+                const int32_t* arrival = table.arrivalTime.data();
+                narrowRows(rows, [=](uint32_t r) {
+                    return arrival[r] != NO_TIMESTAMP && arrival[r] >= low && arrival[r] <= high;
+                });
+                break;
+            }
+        }
+    }
+}
+
+// Function to compile the query once for each table of the dataset
+vector<QueryPlan> compileForDataset(const TyphoonQuery& query, const TyphoonDataset& dataset) {
+    vector<QueryPlan> plans;
+    plans.reserve(dataset.tableCount());
+    for (size_t t = 0; t < dataset.tableCount(); ++t) plans.push_back(compileQuery(query, dataset.table(t)));
+    return plans;
+}
+
+// Function to call visit(table, row) for every row of the dataset matching the query, in dataset
+// order. The chunks are filtered in parallel; visit itself always runs on the calling thread.
+template <typename Visit>
+void forEachMatch(const TyphoonDataset& dataset, const TyphoonQuery& query, Visit visit) {
+    vector<QueryPlan> plans = compileForDataset(query, dataset);
+    vector<ScanChunk> chunks = chunkDataset(dataset);
+    vector<vector<uint32_t>> matches(chunks.size());
+    parallelChunks(chunks.size(), [&](size_t c) {
+        const ScanChunk& chunk = chunks[c];
+        executePlan(plans[chunk.table], dataset.table(chunk.table), chunk.begin, chunk.end, matches[c]);
+    });
+    for (size_t c = 0; c < chunks.size(); ++c) {
+        const TyphoonTable& table = dataset.table(chunks[c].table);
+        for (uint32_t r : matches[c]) visit(table, r);
+    }
+}
+
+// Function to find the region a seeded place belongs to: its index among the regions of
+// PLACE_SEED, or -1 for places outside the seed list
+int regionOfPlace(const string& place) {
+    static const unordered_map<string, int> regions = [] {
+        unordered_map<string, int> m;
+        int region = -1;
+        for (const char* seed : PLACE_SEED) {
+            const string name = seed;
+            if (name.compare(0, 7, "Region ") == 0 || name == "CAR" || name == "NCR" || name == "BARMM") ++region;
+            m.emplace(name, region);
+        }
+        return m;
+    }();
+    auto it = regions.find(place);
+    return it != regions.end() ? it->second : -1;
+}
+
+// Function to give the display name of a region index returned by regionOfPlace
+const string& regionName(int region) {
+    static const vector<string> names = [] {
+        vector<string> v;
+        for (const char* seed : PLACE_SEED) {
+            if (regionOfPlace(seed) == static_cast<int>(v.size())) v.push_back(seed);
+        }
+        return v;
+    }();
+    return names[region];
+}
+
+// Running totals for one group of an aggregate query
+struct GroupTotals {
+    size_t count = 0;
+    double damages = 0.0;
+    long long casualties = 0;
+    int maxWind = 0;
+
+    void add(const TyphoonTable& table, size_t i) {
+        ++count;
+        damages += table.damages[i];
+        casualties += table.casualties[i];
+        maxWind = max(maxWind, table.windSpeed[i]);
+    }
+    void merge(const GroupTotals& other) {
+        count += other.count;
+        damages += other.damages;
+        casualties += other.casualties;
+        maxWind = max(maxWind, other.maxWind);
+    }
+};
+
+// Function to aggregate the matching rows in one pass, grouped as the query asks. Groups are
+// keyed by (order, label): years and months in calendar order, levels by severity, regions in PSGC
+// order. Every chunk aggregates into its own groups, which are merged in chunk order.
+map<pair<int, string>, GroupTotals> aggregateTyphoons(const TyphoonDataset& dataset, const TyphoonQuery& query) {
+    static const char* const monthNames[] = {"Unknown", "January", "February", "March", "April", "May", "June",
+                                             "July", "August", "September", "October", "November", "December"};
+    vector<QueryPlan> plans = compileForDataset(query, dataset);
+    vector<vector<int>> codeRegions(dataset.tableCount());
+    if (query.groupBy == GROUP_REGION) {
+        for (size_t t = 0; t < dataset.tableCount(); ++t) {
+            const vector<string>& places = dataset.table(t).placeNames.values;
+            codeRegions[t].assign(places.size(), -1);
+            for (size_t c = 1; c < places.size(); ++c) codeRegions[t][c] = regionOfPlace(places[c]);
+        }
+    }
+
+    vector<ScanChunk> chunks = chunkDataset(dataset);
+    vector<map<pair<int, string>, GroupTotals>> partial(chunks.size());
+    parallelChunks(chunks.size(), [&](size_t c) {
+        const ScanChunk& chunk = chunks[c];
+        const TyphoonTable& table = dataset.table(chunk.table);
+        const vector<int>& codeRegion = codeRegions[chunk.table];
+        map<pair<int, string>, GroupTotals>& groups = partial[c];
+        vector<uint32_t> rows;
+        executePlan(plans[chunk.table], table, chunk.begin, chunk.end, rows);
+        for (uint32_t i : rows) {
+            switch (query.groupBy) {
+                case GROUP_NONE:
+                    groups[{0, "All"}].add(table, i);
+                    break;
+                case GROUP_YEAR:
+                    groups[{table.year[i], to_string(table.year[i])}].add(table, i);
+                    break;
+                case GROUP_MONTH:
+                    groups[{table.monthNumber[i], monthNames[table.monthNumber[i]]}].add(table, i);
+                    break;
+                case GROUP_LEVEL: {
+                    const string& level = table.levelsText(i);
+                    groups[{table.levels[i] <= LEVEL_SUPER_TYPHOON ? table.levels[i] : 100, level.empty() ? "Unknown" : level}].add(table, i);
+                    break;
+                }
+                case GROUP_REGION: {
+                    // A storm counts once per region, however many of its provinces were hit
+                    uint32_t regionsHit = 0;
+                    const uint64_t* bits = table.placeRow(i);
+                    for (size_t w = 0; w < table.placeWords; ++w) {
+                        for (uint64_t word = bits[w]; word; word &= word - 1) {
+                            const size_t code = w * 64 + countTrailingZeros(word);
+                            if (code < codeRegion.size() && codeRegion[code] >= 0) regionsHit |= uint32_t(1) << codeRegion[code];
+                        }
+                    }
+                    for (uint32_t hit = regionsHit; hit; hit &= hit - 1) {
+                        const int region = countTrailingZeros(hit);
+                        groups[{region, regionName(region)}].add(table, i);
+                    }
+                    break;
+                }
+            }
+        }
+    });
+
+    if (partial.size() == 1) return move(partial[0]);
+    map<pair<int, string>, GroupTotals> groups;
+    for (const auto& chunkGroups : partial) {
+        for (const auto& group : chunkGroups) groups[group.first].merge(group.second);
+    }
+    return groups;
+}
+
+// Function to write one projected field of a row
+void reportField(ReportWriter& report, const TyphoonTable& table, size_t i, QueryField field) {
+    switch (field) {
+        case FIELD_NAME: report << table.name[i]; break;
+        case FIELD_YEAR: report << table.year[i]; break;
+        case FIELD_MONTH: report << table.month[i]; break;
+        case FIELD_WIND: report << table.windSpeed[i]; break;
+        case FIELD_CASUALTIES: report << table.casualties[i]; break;
+        case FIELD_DAMAGES: report.money(table.damages[i]); break;
+        case FIELD_LEVEL: report << table.levelsText(i); break;
+        case FIELD_CROSSING: report << table.stormCrossingText(i); break;
+        case FIELD_DEVELOPED: report << table.developedText(i); break;
+        case FIELD_STAY: report << table.stayHours[i]; break;
+        default: report << table.placesAffected[i]; break;
+    }
+}
+
+// Function to report the matching rows with the query's projected fields, one row per line
+void reportSelection(ReportWriter& report, const TyphoonDataset& dataset, const TyphoonQuery& query) {
+    for (size_t f = 0; f < query.fields.size(); ++f) {
+        report << (f ? " | " : "") << QUERY_FIELD_NAMES[query.fields[f]];
+    }
+    report << '\n';
+    size_t matched = 0;
+    forEachMatch(dataset, query, [&](const TyphoonTable& table, uint32_t i) {
+        for (size_t f = 0; f < query.fields.size(); ++f) {
+            if (f) report << " | ";
+            reportField(report, table, i, query.fields[f]);
+        }
+        report << '\n';
+        ++matched;
+    });
+    report << matched << " typhoon(s) matched.\n";
+}
+
+// Function to report count, damages, casualties and peak wind per group
+void reportAggregate(ReportWriter& report, const TyphoonDataset& dataset, const TyphoonQuery& query) {
+    static const char* const groupNames[] = {"All Typhoons", "Year", "Month", "Level", "Region"};
+    map<pair<int, string>, GroupTotals> groups = aggregateTyphoons(dataset, query);
+    report << "-- " << (query.groupBy == GROUP_NONE ? "" : "Typhoons by ") << groupNames[query.groupBy] << " --\n";
+    for (const auto& group : groups) {
+        const GroupTotals& totals = group.second;
+        report << group.first.second << " - " << totals.count << " typhoon(s), ";
+        report.money(totals.damages) << " Peso damages, " << totals.casualties << " casualties, max "
+                                     << totals.maxWind << " km/h\n";
+    }
+    if (groups.empty()) report << "No typhoons match.\n";
+}
+
+// Function to write the "N. Name - value" lines of a ranking
+void reportRanking(ReportWriter& report, const TyphoonDataset& dataset, const vector<RankedRow>& ranked, RankKey key) {
+    for (size_t i = 0; i < ranked.size(); ++i) {
+        TyphoonDataset::RowRef ref = dataset.locate(ranked[i].row);
+        report << (i + 1) << ". " << ref.table->name[ref.row] << " - ";
+        switch (key) {
+            case RANK_WIND: report << ref.table->windSpeed[ref.row] << " km/h"; break;
+            case RANK_CASUALTIES: report << ref.table->casualties[ref.row] << " casualties"; break;
+            case RANK_DAMAGES: report.money(ref.table->damages[ref.row]) << " Peso"; break;
+            default: report << ref.table->stayHours[ref.row] << " hours"; break;
+        }
+        report << '\n';
+    }
+}
+
+// Function to report the Top 3 Strongest Typhoons
+void reportTop3Strongest(ReportWriter& report, const TyphoonDataset& dataset) {
+    report << "-- Top 3 Strongest Typhoons from " << yearSpan(dataset) << " --\n";
+    reportRanking(report, dataset, rankTyphoons(dataset, RANK_WIND, 3), RANK_WIND);
+}
+
+// Function to report the Top K Typhoons by any numeric field
+void reportTopK(ReportWriter& report, const TyphoonDataset& dataset, RankKey key, size_t k) {
+    static const char* const keyNames[] = {"Wind Speed", "Casualties", "Damages", "Stay Duration"};
+    vector<RankedRow> top = rankTyphoons(dataset, key, k);
+    report << "-- Top " << top.size() << " Typhoons by " << keyNames[key] << " --\n";
+    reportRanking(report, dataset, top, key);
+}
+
+// Function to report the Most Damaging Typhoon
+void reportMostDamaging(ReportWriter& report, const TyphoonDataset& dataset) {
+    vector<RankedRow> most = rankTyphoons(dataset, RANK_DAMAGES, 1);
+    if (most.empty()) {
+        report << "No typhoon data available.\n";
+        return;
+    }
+    TyphoonDataset::RowRef ref = dataset.locate(most[0].row);
+
+    report << "The " << ref.table->name[ref.row]
+           << " is considered the most damaging typhoon that entered the Philippines with ";
+    report.money(ref.table->damages[ref.row]) << " pesos in cost of damage.\n";
+}
+
+// Function to visit every storm in name order (A-Z) as visit(table, row), merging the tables'
+// name indexes; international name entries are skipped so each storm is visited once
+template <typename Visit>
+void forEachByName(const TyphoonDataset& dataset, Visit visit) {
+    struct Cursor {
+        size_t table;
+        const NameKey* at;
+        const NameKey* end;
+    };
+    auto later = [&dataset](const Cursor& a, const Cursor& b) {
+        if (a.at->key != b.at->key) return a.at->key > b.at->key;
+        const string_view nameA = dataset.table(a.table).name[a.at->row];
+        const string_view nameB = dataset.table(b.table).name[b.at->row];
+        if (nameA != nameB) return nameA > nameB;
+        return a.table > b.table;
+    };
+    priority_queue<Cursor, vector<Cursor>, decltype(later)> heads(later);
+    auto advance = [&heads](Cursor c) {
+        while (c.at != c.end && c.at->international) ++c.at;
+        if (c.at != c.end) heads.push(c);
+    };
+    for (size_t t = 0; t < dataset.tableCount(); ++t) {
+        const vector<NameKey>& index = dataset.table(t).nameIndex;
+        advance({t, index.data(), index.data() + index.size()});
+    }
+    while (!heads.empty()) {
+        Cursor c = heads.top();
+        heads.pop();
+        visit(dataset.table(c.table), c.at->row);
+        ++c.at;
+        advance(c);
+    }
+}
+
+// Function to report all names alphabetically
+void reportAlphabetical(ReportWriter& report, const TyphoonDataset& dataset) {
+    report << "-- List of Typhoons from " << yearSpan(dataset) << " (A-Z) --\n";
+    forEachByName(dataset, [&](const TyphoonTable& table, size_t i) {
+        report << table.name[i] << '\n';
+    });
+}
+
+// Function to compute the edit distance between a and b, counting insertions, deletions,
+// substitutions and swaps of adjacent letters. Gives up with maxEdits + 1 once it must exceed
+// maxEdits. scratch is reused between calls.
+int editDistance(string_view a, string_view b, int maxEdits, vector<int>& scratch) {
+    const size_t n = b.size() + 1;
+    if (a.size() > b.size() + maxEdits || b.size() > a.size() + maxEdits) return maxEdits + 1;
+    scratch.assign(3 * n, 0);
+    int* before = scratch.data();
+    int* prev = before + n;
+    int* cur = prev + n;
+    for (size_t j = 0; j < n; ++j) prev[j] = int(j);
+    for (size_t i = 1; i <= a.size(); ++i) {
+        cur[0] = int(i);
+        int rowMin = cur[0];
+        for (size_t j = 1; j < n; ++j) {
+            cur[j] = min({prev[j] + 1, cur[j - 1] + 1, prev[j - 1] + (a[i - 1] == b[j - 1] ? 0 : 1)});
+            if (i > 1 && j > 1 && a[i - 1] == b[j - 2] && a[i - 2] == b[j - 1]) cur[j] = min(cur[j], before[j - 2] + 1);
+            rowMin = min(rowMin, cur[j]);
+        }
+        if (rowMin > maxEdits) return maxEdits + 1;
+        int* oldest = before;
+        before = prev;
+        prev = cur;
+        cur = oldest;
+    }
+    return min(prev[n - 1], maxEdits + 1);
+}
+
+// A storm found by name; distance is the edit distance for close-spelling matches
+struct NameMatch {
+    const TyphoonTable* table;
+    uint32_t row;
+    string_view key;
+    int distance;
+};
+
+enum NameMatchKind { NAME_NOT_FOUND, NAME_EXACT, NAME_PREFIX, NAME_CLOSE };
+
+// Function to look a storm up by local or international name, trying in turn the exact name
+// (binary search in each table's name index), names starting with it and names within one edit
+// (two for names longer than four letters). Matches are sorted by distance, name and year.
+NameMatchKind findNames(const TyphoonDataset& dataset, const string& name, vector<NameMatch>& matches) {
+    const string query = normalizedLower(name);
+    matches.clear();
+    if (query.empty()) return NAME_NOT_FOUND;
+    auto byKey = [](const NameKey& entry, string_view key) { return entry.key < key; };
+    auto collect = [&](auto select) {
+        for (size_t t = 0; t < dataset.tableCount(); ++t) {
+            const TyphoonTable& table = dataset.table(t);
+            select(table, lower_bound(table.nameIndex.begin(), table.nameIndex.end(), query, byKey));
+        }
+        // A storm whose local and international names both match is listed once, at its best
+        sort(matches.begin(), matches.end(), [](const NameMatch& a, const NameMatch& b) {
+            if (a.table != b.table || a.row != b.row) return a.table != b.table ? a.table < b.table : a.row < b.row;
+            return a.distance < b.distance;
+        });
+        matches.erase(unique(matches.begin(), matches.end(), [](const NameMatch& a, const NameMatch& b) {
+            return a.table == b.table && a.row == b.row;
+        }), matches.end());
+        sort(matches.begin(), matches.end(), [](const NameMatch& a, const NameMatch& b) {
+            if (a.distance != b.distance) return a.distance < b.distance;
+            if (a.key != b.key) return a.key < b.key;
+            if (a.table->year[a.row] != b.table->year[b.row]) return a.table->year[a.row] < b.table->year[b.row];
+            return a.table->name[a.row] < b.table->name[b.row];
+        });
+        return !matches.empty();
+    };
+
+    if (collect([&](const TyphoonTable& table, auto it) {
+            for (; it != table.nameIndex.end() && it->key == query; ++it) matches.push_back({&table, it->row, it->key, 0});
+        })) {
+        return NAME_EXACT;
+    }
+    if (collect([&](const TyphoonTable& table, auto it) {
+            for (; it != table.nameIndex.end() && it->key.compare(0, query.size(), query) == 0; ++it) {
+                matches.push_back({&table, it->row, it->key, 0});
+            }
+        })) {
+        return NAME_PREFIX;
+    }
+    const int maxEdits = query.size() <= 4 ? 1 : 2;
+    vector<int> scratch;
+    if (collect([&](const TyphoonTable& table, auto) {
+            const NameKey* scored = nullptr;
+            int distance = maxEdits + 1;
+            for (const NameKey& entry : table.nameIndex) {
+                // Keys repeat (recycled names, one storm per year), so each distinct key is scored once
+                if (!scored || entry.key != scored->key) {
+                    distance = editDistance(entry.key, query, maxEdits, scratch);
+                    scored = &entry;
+                }
+                if (distance <= maxEdits) matches.push_back({&table, entry.row, entry.key, distance});
+            }
+        })) {
+        return NAME_CLOSE;
+    }
+    return NAME_NOT_FOUND;
+}
+
+// Function to report a name search: full details for storms with that exact name, otherwise the
+// names that start with it, otherwise the closest spellings
+const size_t NAME_MATCH_LIMIT = 20;
+
+void reportNameSearch(ReportWriter& report, const TyphoonDataset& dataset, const string& name) {
+    vector<NameMatch> matches;
+    const NameMatchKind kind = findNames(dataset, name, matches);
+    if (kind == NAME_NOT_FOUND) {
+        report << "No typhoon named \"" << name << "\" in " << yearSpan(dataset) << ".\n";
+        return;
+    }
+    if (kind == NAME_EXACT) {
+        for (const NameMatch& m : matches) renderTyphoon(report, *m.table, m.row);
+        return;
+    }
+    if (kind == NAME_PREFIX) {
+        report << "-- Typhoons whose name starts with \"" << name << "\" --\n";
+    } else {
+        report << "No typhoon named \"" << name << "\". Did you mean:\n";
+    }
+    for (size_t i = 0; i < matches.size() && i < NAME_MATCH_LIMIT; ++i) {
+        const TyphoonTable& table = *matches[i].table;
+        report << table.name[matches[i].row] << " (" << table.month[matches[i].row] << " "
+               << table.year[matches[i].row] << ")\n";
+    }
+    if (matches.size() > NAME_MATCH_LIMIT) report << "... and " << matches.size() - NAME_MATCH_LIMIT << " more\n";
+}
+
+// Function to report the Longest Stay
+void reportLongestStay(ReportWriter& report, const TyphoonDataset& dataset) {
+    vector<RankedRow> longest = rankTyphoons(dataset, RANK_DURATION, 1);
+    if (longest.empty() || longest[0].key < 0) {
+        report << "No typhoon data available.\n";
+        return;
+    }
+    TyphoonDataset::RowRef ref = dataset.locate(longest[0].row);
+    const int hours = ref.table->stayHours[ref.row];
+
+    report << "The " << ref.table->name[ref.row] << " had the longest stay with ";
+    report.fixed(hours / 24.0, 1) << " days (" << hours << " hours).\n";
+}
+
+// Function to report the typhoons that made landfall
+void reportLandfall(ReportWriter& report, const TyphoonDataset& dataset) {
+    TyphoonQuery landfall;
+    landfall.crossing = "Land";
+    report << "-- Typhoons that made Landfall --\n";
+    forEachMatch(dataset, landfall, [&](const TyphoonTable& table, uint32_t i) {
+        report << table.name[i] << '\n';
+    });
+}
+
+// Function to report every typhoon of one calendar month, across the years in the dataset
+void reportMonth(ReportWriter& report, const TyphoonDataset& dataset, int month) {
+    size_t shown = 0;
+    for (size_t t = 0; t < dataset.tableCount(); ++t) {
+        const TyphoonTable& table = dataset.table(t);
+        for (int year : table.indexYears) {
+            RowSpan rows = getTyphoonsForMonth(table, year, month);
+            for (uint32_t i : rows) renderTyphoon(report, table, i);
+            shown += rows.size();
+        }
+    }
+    if (shown == 0) report << "No typhoons recorded for this month.\n";
+}
+
+// Function to count, per place code, the distinct (year, month) buckets with at least one
+// storm hitting it. Rows of a month are OR-ed together first, so each month costs one pass.
+vector<int> countPlaceMonths(const TyphoonTable& table) {
+    vector<int> months(table.placeNames.values.size(), 0);
+    vector<uint64_t> monthMask(table.placeWords);
+    const size_t buckets = table.monthIndexStart.empty() ? 0 : table.monthIndexStart.size() - 1;
+    for (size_t b = 0; b < buckets; ++b) {
+        if (b % 13 == 0) continue; // unknown-month bucket
+        uint32_t first = table.monthIndexStart[b], last = table.monthIndexStart[b + 1];
+        if (first == last) continue;
+        fill(monthMask.begin(), monthMask.end(), 0);
+        for (uint32_t k = first; k < last; ++k) {
+            const uint64_t* bits = table.placeRow(table.monthIndexRows[k]);
+            for (size_t w = 0; w < table.placeWords; ++w) monthMask[w] |= bits[w];
+        }
+        for (size_t w = 0; w < table.placeWords; ++w) {
+            for (uint64_t word = monthMask[w]; word; word &= word - 1) {
+                ++months[w * 64 + countTrailingZeros(word)];
+            }
+        }
+    }
+    return months;
+}
+
+// Function to report the typhoons that hit a province or region (any spelling canonicalPlaces accepts)
+void reportByPlace(ReportWriter& report, const TyphoonDataset& dataset, const string& place) {
+    vector<string> places;
+    canonicalPlaces(place, places);
+    if (places.empty()) {
+        report << "Invalid place.\n";
+        return;
+    }
+
+    TyphoonQuery hitPlace;
+    hitPlace.place = places.front();
+    report << "-- Typhoons that hit " << places.front() << " --\n";
+    int hits = 0;
+    forEachMatch(dataset, hitPlace, [&](const TyphoonTable& table, uint32_t i) {
+        report << table.name[i] << " (" << table.month[i] << " " << table.year[i] << ")\n";
+        ++hits;
+    });
+    if (hits == 0) report << "No typhoons recorded for this place.\n";
+}
+
+// Function to report the provinces/regions hit by typhoons in more than N months
+void reportPlacesHitInMonths(ReportWriter& report, const TyphoonDataset& dataset, int threshold) {
+    map<string, int> monthsByPlace;
+    for (size_t t = 0; t < dataset.tableCount(); ++t) {
+        const TyphoonTable* table = &dataset.table(t);
+        vector<int> months = countPlaceMonths(*table);
+        for (size_t code = 1; code < months.size(); ++code) {
+            if (months[code] > 0) monthsByPlace[table->placeNames.text(static_cast<uint16_t>(code))] += months[code];
+        }
+    }
+    vector<pair<string, int>> ranked;
+    for (const auto& entry : monthsByPlace) {
+        if (entry.second > threshold) ranked.push_back(entry);
+    }
+    stable_sort(ranked.begin(), ranked.end(), [](const pair<string, int>& a, const pair<string, int>& b) {
+        return a.second > b.second;
+    });
+
+    report << "-- Places hit by typhoons in more than " << threshold << " month(s) --\n";
+    for (const auto& entry : ranked) {
+        report << entry.first << " - " << entry.second << " month(s)\n";
+    }
+    if (ranked.empty()) report << "No places match.\n";
+}
+
+// Function to run the work of a search as one timed operation; its prompts are not timed
+template <typename Work>
+void timedSearch(StatId id, size_t rows, Work work) {
+    ScopedTimer timer(id);
+    timer.addItems(rows);
+    work();
+    consoleReport.flush();
+}
+
+// Function to write a report over a whole dataset through the result cache; columns are the
+// column groups the report reads
+template <typename Render>
+void cachedReport(const TyphoonDataset& dataset, const string& name, unsigned columns, Render render) {
+    resultCache.write(consoleReport, datasetKey(name, dataset), datasetDependencies(dataset, columns),
+                      [&](ReportWriter& out) {
+                          render(out);
+                          return true;
+                      });
+}
+
+// Function for search: Top 3 Strongest Typhoons
+void searchTop3Strongest(const TyphoonDataset& dataset) {
+    timedSearch(STAT_SEARCH_TOP3, dataset.size(), [&] {
+        cachedReport(dataset, "top3", COLUMNS_NAME | COLUMNS_WIND | COLUMNS_DATES,
+                     [&](ReportWriter& out) { reportTop3Strongest(out, dataset); });
+    });
+    searchFollowUp("These top typhoons highlight the need for advanced wind-resistant infrastructure and early warning systems.");
+}
+
+// Function for search: Top K Typhoons by any numeric field
+void searchTopK(const TyphoonDataset& dataset) {
+    cout << "Rank by: 1. Wind Speed  2. Casualties  3. Damages  4. Stay Duration" << endl;
+    cout << "Enter your choice: ";
+    int keyChoice;
+    long long count = 0; // signed, so -1 is refused instead of wrapping to the whole archive
+    cin >> keyChoice;
+    if (!cin.fail()) {
+        cout << "How many typhoons? ";
+        cin >> count;
+    }
+    if (cin.fail() || keyChoice < 1 || keyChoice > 4 || count <= 0) {
+        cin.clear();
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+        cout << "Invalid choice." << endl;
+        return;
+    }
+    static const unsigned keyColumns[] = {COLUMNS_WIND, COLUMNS_CASUALTIES, COLUMNS_DAMAGES, COLUMNS_DATES};
+    const RankKey key = static_cast<RankKey>(keyChoice - 1);
+    const size_t k = min(static_cast<unsigned long long>(count), static_cast<unsigned long long>(dataset.size()));
+    timedSearch(STAT_SEARCH_TOP_K, dataset.size(), [&] {
+        cachedReport(dataset, "top " + to_string(keyChoice) + " " + to_string(k), COLUMNS_NAME | keyColumns[key],
+                     [&](ReportWriter& out) { reportTopK(out, dataset, key, k); });
+    });
+    searchFollowUp("Ranking storms by their impact shows where preparedness spending saves the most.");
+}
+
+// Function for search: Most Damaging Typhoon
+void searchMostDamaging(const TyphoonDataset& dataset) {
+    if (dataset.empty()) {
+        cout << "No typhoon data available." << endl;
+        return;
+    }
+    timedSearch(STAT_SEARCH_MOST_DAMAGING, dataset.size(), [&] {
+        cachedReport(dataset, "most-damaging", COLUMNS_NAME | COLUMNS_DAMAGES,
+                     [&](ReportWriter& out) { reportMostDamaging(out, dataset); });
+    });
+    searchFollowUp("This typhoon caused significant economic losses, highlighting the need for better infrastructure and financial preparedness.");
+}
+
+// Function for search: Top 3 Strongest Typhoons, ranked straight from the mapped wind column
+void searchTop3Strongest(const MappedArchive& archive) {
+    timedSearch(STAT_SEARCH_TOP3, archive.size(), [&] {
+        const int32_t* wind = archive.windSpeeds();
+        const int32_t* years = archive.years();
+        int32_t firstYear = 0, lastYear = 0;
+        if (archive.size() > 0) minMax(years, archive.size(), firstYear, lastYear);
+        vector<RankedRow> top = topK(archive.size(), 3, [wind](size_t i) { return wind[i]; });
+
+        cout << "-- Top 3 Strongest Typhoons from " << firstYear << " - " << lastYear << " --" << endl;
+        for (size_t i = 0; i < top.size(); ++i) {
+            cout << (i + 1) << ". " << archive.name(top[i].row) << " - " << wind[top[i].row] << " km/h" << endl;
+        }
+    });
+    searchFollowUp("These top typhoons highlight the need for advanced wind-resistant infrastructure and early warning systems.");
+}
+
+// Function for search: Most Damaging Typhoon, scanned straight from the mapped damages column
+void searchMostDamaging(const MappedArchive& archive) {
+    if (archive.size() == 0) {
+        cout << "No typhoon data available." << endl;
+        return;
+    }
+    timedSearch(STAT_SEARCH_MOST_DAMAGING, archive.size(), [&] {
+        const double* damages = archive.damages();
+        const size_t most = argMax(damages, archive.size());
+
+        cout << "The " << archive.name(most)
+             << " is considered the most damaging typhoon that entered the Philippines with "
+             << fixed << setprecision(2) << damages[most] << " pesos in cost of damage." << endl;
+    });
+    searchFollowUp("This typhoon caused significant economic losses, highlighting the need for better infrastructure and financial preparedness.");
+}
+
+// Function for search: List all names alphabetically
+void searchAlphabetical(const TyphoonDataset& dataset) {
+    timedSearch(STAT_SEARCH_ALPHABETICAL, dataset.size(), [&] {
+        cachedReport(dataset, "names", COLUMNS_NAME | COLUMNS_DATES,
+                     [&](ReportWriter& out) { reportAlphabetical(out, dataset); });
+    });
+    searchFollowUp("Listing typhoons alphabetically aids in systematic tracking and historical analysis.");
+}
+
+// Function for search: Longest Stay
+void searchLongestStay(const TyphoonDataset& dataset) {
+    bool found = true; // a cached answer was found
+    timedSearch(STAT_SEARCH_LONGEST_STAY, dataset.size(), [&] {
+        resultCache.write(consoleReport, datasetKey("longest-stay", dataset),
+                          datasetDependencies(dataset, COLUMNS_NAME | COLUMNS_DATES), [&](ReportWriter& out) {
+            vector<RankedRow> longest = rankTyphoons(dataset, RANK_DURATION, 1);
+            found = !longest.empty() && longest[0].key >= 0;
+            if (found) reportLongestStay(out, dataset);
+            return found;
+        });
+    });
+    if (!found) {
+        cout << "No typhoon data available." << endl;
+        return;
+    }
+    searchFollowUp("Extended stays increase exposure time, necessitating prolonged preparedness measures.");
+}
+
+// Function for search: Sort by Landfall
+void searchLandfall(const TyphoonDataset& dataset) {
+    timedSearch(STAT_SEARCH_LANDFALL, dataset.size(), [&] {
+        cachedReport(dataset, "landfall", COLUMNS_NAME | COLUMNS_CLASS,
+                     [&](ReportWriter& out) { reportLandfall(out, dataset); });
+    });
+    searchFollowUp("Landfall typhoons pose direct threats, requiring focused coastal defense strategies.");
+}
+
+// Function for search: Typhoons that hit a given province or region
+void searchByPlace(const TyphoonDataset& dataset) {
+    cout << "Enter a province or region: ";
+    string input;
+    cin.ignore(numeric_limits<streamsize>::max(), '\n');
+    getline(cin, input);
+    vector<string> places;
+    canonicalPlaces(input, places);
+    if (places.empty()) {
+        cout << "Invalid place." << endl;
+        return;
+    }
+    timedSearch(STAT_SEARCH_BY_PLACE, dataset.size(), [&] {
+        cachedReport(dataset, "place " + places.front(), COLUMNS_NAME | COLUMNS_DATES | COLUMNS_PLACES,
+                     [&](ReportWriter& out) { reportByPlace(out, dataset, input); });
+    });
+    searchFollowUp("Knowing which storms repeatedly reach a province helps target its preparedness funding.");
+}
+
+// Function for search: Find a typhoon by name, the start of a name or a close spelling
+void searchByName(const TyphoonDataset& dataset) {
+    cout << "Enter a typhoon name (local or international): ";
+    string input;
+    cin.ignore(numeric_limits<streamsize>::max(), '\n');
+    getline(cin, input);
+    if (normalizedLower(input).empty()) {
+        cout << "Invalid name." << endl;
+        return;
+    }
+    timedSearch(STAT_SEARCH_BY_NAME, dataset.size(), [&] {
+        cachedReport(dataset, "name " + input, COLUMNS_ALL,
+                     [&](ReportWriter& out) { reportNameSearch(out, dataset, input); });
+    });
+    searchFollowUp("Finding a storm by name ties today's bulletins to its full record in the archive.");
+}
+
+// Function for search: Provinces/regions hit by typhoons in more than N months
+void searchPlacesHitInMonths(const TyphoonDataset& dataset) {
+    int threshold;
+    cout << "Show places hit in more than how many months? ";
+    cin >> threshold;
+    if (cin.fail()) {
+        cin.clear();
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+        cout << "Invalid input. Please enter a number." << endl;
+        return;
+    }
+    timedSearch(STAT_SEARCH_PLACES_HIT, dataset.size(), [&] {
+        cachedReport(dataset, "places-months " + to_string(threshold), COLUMNS_DATES | COLUMNS_PLACES,
+                     [&](ReportWriter& out) { reportPlacesHitInMonths(out, dataset, threshold); });
+    });
+    searchFollowUp("Places struck month after month need permanent, not seasonal, disaster infrastructure.");
+}
+
+// Function to split loaded records into one table per year, oldest year first
+vector<TyphoonTable> buildYearTables(vector<Typhoon>&& typhoons) {
+    stable_sort(typhoons.begin(), typhoons.end(), [](const Typhoon& a, const Typhoon& b) {
+        return a.year < b.year;
+    });
+    vector<vector<Typhoon>> years;
+    size_t start = 0;
+    while (start < typhoons.size()) {
+        size_t end = start;
+        while (end < typhoons.size() && typhoons[end].year == typhoons[start].year) ++end;
+        years.emplace_back(make_move_iterator(typhoons.begin() + start), make_move_iterator(typhoons.begin() + end));
+        start = end;
+    }
+    typhoons.clear();
+
+    // Years are built side by side; a single year is left to buildTable's own chunking
+    vector<TyphoonTable> tables(years.size());
+    if (years.size() == 1) {
+        tables[0] = buildTable(move(years[0]));
+    } else {
+        parallelChunks(years.size(), [&](size_t y) { tables[y] = buildTable(move(years[y]), false); });
+    }
+    return tables;
+}
+
+// ---------------------------------------------------------------------------
+// Bulletin log
+//
+// New storms and updated figures arrive as bulletins, one per line, appended to a log file
+// (--wal <file>) and applied to the loaded tables in place instead of reloading the archive:
+//   2025,Uwan,0800_11/07,...        a full archive row: replaces that year's storm of the same
+//                                   name, or adds it
+//   update,2025,Uwan,casualties,27,damages,1250000.50
+//                                   new values for some columns, named as in the archive header
+// Applying a bulletin sets values, so replaying a log twice gives the same tables. A session
+// replays the log after loading and picks up lines appended since before every menu or query.
+// ---------------------------------------------------------------------------
+
+struct Bulletin {
+    bool update = false;
+    Typhoon record; // the full record, or only the year and name of the storm to update
+    vector<pair<string_view, string_view>> fields; // update: column name, new value
+};
+
+// Tables bulletins apply to: the table holding each year, or one table holding every year.
+// With newYears set, a full record for a year without a table starts a new one there. Snapshot
+// writers set writableYear instead, which hands out their own copy of a year's table (a new
+// table when create is set and the year has none, else nullptr).
+struct BulletinTarget {
+    map<int, TyphoonTable*> years;
+    TyphoonTable* allYears = nullptr;
+    deque<TyphoonTable>* newYears = nullptr;
+    function<TyphoonTable*(int year, bool create)> writableYear;
+};
+
+// Function to set one column of a record from bulletin text
+bool setBulletinField(Typhoon& t, string_view field, string_view value, string& error) {
+    static const pair<const char*, string_view Typhoon::*> textFields[] = {
+        {"arrival", &Typhoon::arrival}, {"departure", &Typhoon::departure}, {"month", &Typhoon::month},
+        {"interval", &Typhoon::interval}, {"stormCrossing", &Typhoon::stormCrossing},
+        {"timeOfLandfall", &Typhoon::timeOfLandfall}, {"developed", &Typhoon::developed},
+        {"pathType", &Typhoon::pathType}, {"levels", &Typhoon::levels},
+        {"placesAffected", &Typhoon::placesAffected},
+    };
+    const char* b = value.data();
+    const char* e = b + value.size();
+    bool ok = true;
+    if (field == "windSpeed") {
+        ok = parseNumber(b, e, t.windSpeed);
+    } else if (field == "casualties") {
+        ok = parseNumber(b, e, t.casualties);
+    } else if (field == "damages") {
+        ok = parseNumber(b, e, t.damages);
+    } else {
+        for (const auto& textField : textFields) {
+            if (field == textField.first) {
+                t.*textField.second = value;
+                return true;
+            }
+        }
+        error = "unknown field '" + string(field) + "'";
+        return false;
+    }
+    if (!ok) error = "invalid number '" + string(value) + "' for " + string(field);
+    return ok;
+}
+
+// Function to parse one bulletin line. Its fields view line, or text for unescaped quotes.
+bool parseBulletin(string_view line, Bulletin& bulletin, StringArena& text, string& error) {
+    bulletin = Bulletin();
+    if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+    if (line.find('\n') != string_view::npos) {
+        error = "line break inside bulletin";
+        return false;
+    }
+    const char* p = line.data();
+    const char* e = p + line.size();
+    string_view op;
+    const char* next = parseCsvField(p, e, op, text);
+    if (op != "update") {
+        vector<Typhoon> records;
+        vector<LoadWarning> warnings;
+        parseTyphoonLines(p, e, 0, false, records, text, warnings);
+        if (records.empty()) {
+            error = warnings.empty() ? "empty bulletin" : warnings[0].reason;
+            return false;
+        }
+        bulletin.record = records[0];
+    } else {
+        bulletin.update = true;
+        p = next;
+        const char* fe;
+        next = skipCsvField(p, e, fe);
+        if (!parseNumber(p, fe, bulletin.record.year)) {
+            error = "invalid year";
+            return false;
+        }
+        p = parseCsvField(next, e, bulletin.record.name, text);
+        Typhoon check = bulletin.record;
+        while (p < e) {
+            string_view field, value;
+            const char* valueStart = parseCsvField(p, e, field, text);
+            if (valueStart == e && valueStart[-1] != ',') {
+                error = "no value for " + string(field);
+                return false;
+            }
+            p = parseCsvField(valueStart, e, value, text);
+            if (!setBulletinField(check, field, value, error)) return false;
+            bulletin.fields.emplace_back(field, value);
+        }
+        if (bulletin.fields.empty()) {
+            error = "no fields to update";
+            return false;
+        }
+    }
+    string_view local, international;
+    splitStormName(bulletin.record.name, local, international);
+    if (local.empty()) {
+        error = "missing typhoon name";
+        return false;
+    }
+    return true;
+}
+
+// Function to apply one bulletin to its year's table; false if that storm or year is not loaded
+bool applyBulletin(BulletinTarget& target, const Bulletin& bulletin, string& error) {
+    ScopedTimer timer(STAT_APPLY_BULLETIN);
+    const int year = bulletin.record.year;
+    TyphoonTable* table = target.allYears;
+    if (!table && target.writableYear) {
+        table = target.writableYear(year, !bulletin.update);
+    } else if (!table) {
+        auto it = target.years.find(year);
+        if (it != target.years.end()) {
+            table = it->second;
+        } else if (target.newYears && !bulletin.update) {
+            target.newYears->emplace_back();
+            table = target.years[year] = &target.newYears->back();
+        }
+    }
+    if (!table) {
+        error = "year " + to_string(year) + " is not loaded";
+        return false;
+    }
+    const long row = table->findRecord(year, bulletin.record.name);
+    if (!bulletin.update) {
+        Typhoon record = bulletin.record;
+        if (row < 0) table->insertRecord(move(record));
+        else table->replaceRecord(size_t(row), move(record));
+    } else {
+        if (row < 0) {
+            error = "no typhoon named \"" + string(bulletin.record.name) + "\" in " + to_string(year);
+            return false;
+        }
+        Typhoon t = table->record(size_t(row));
+        for (const auto& field : bulletin.fields) setBulletinField(t, field.first, field.second, error);
+        parseTimestamps(t);
+        table->replaceRecord(size_t(row), move(t));
+    }
+    timer.addItems(1);
+    return true;
+}
+
+// Function to chain a bulletin target's year tables into a dataset, oldest year first. Call it
+// again after applying bulletins, which grow tables and may add new ones.
+void chainTables(TyphoonDataset& dataset, const BulletinTarget& target) {
+    dataset = TyphoonDataset();
+    for (const auto& year : target.years) dataset.add(*year.second);
+}
+
+// Reader for a bulletin log. Every poll applies the complete lines appended since the last one;
+// a log that shrank was replaced, and is replayed from the start.
+class BulletinLog {
+public:
+    explicit BulletinLog(const string& path) : path(path) {}
+
+    bool isOpen() const { return !path.empty(); }
+    size_t poll(BulletinTarget& target);
+
+private:
+    string path;
+    uint64_t offset = 0; // bytes of the file applied so far
+    size_t lineNo = 0;
+};
+
+// Function to apply the bulletins appended to the log since the last poll; returns how many
+// were applied. Bad lines are reported and skipped.
+size_t BulletinLog::poll(BulletinTarget& target) {
+    if (path.empty()) return 0;
+    ifstream in(path, ios::binary);
+    if (!in) return 0; // nothing logged yet
+    in.seekg(0, ios::end);
+    const uint64_t fileSize = static_cast<uint64_t>(in.tellg());
+    if (fileSize < offset) offset = lineNo = 0;
+    if (fileSize == offset) return 0;
+    string data(static_cast<size_t>(fileSize - offset), '\0');
+    in.seekg(static_cast<streamoff>(offset));
+    in.read(&data[0], static_cast<streamsize>(data.size()));
+    data.resize(static_cast<size_t>(in.gcount()));
+    const size_t complete = data.rfind('\n');
+    if (complete == string::npos) return 0; // a bulletin still being written
+
+    StringArena text;
+    size_t applied = 0;
+    for (size_t start = 0; start <= complete;) {
+        const size_t end = data.find('\n', start);
+        string_view line(data.data() + start, end - start);
+        start = end + 1;
+        ++lineNo;
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+        if (line.empty() || line[0] == '#') continue;
+        Bulletin bulletin;
+        string error;
+        if (parseBulletin(line, bulletin, text, error) && applyBulletin(target, bulletin, error)) {
+            ++applied;
+        } else {
+            cerr << "Warning: " << path << ":" << lineNo << ": " << error << ", bulletin skipped." << endl;
+        }
+    }
+    offset += complete + 1;
+    return applied;
+}
+
+// Function to append bulletins to a log (created if missing) and flush them to disk. Every line
+// is checked first, so a bad bulletin leaves the log untouched.
+bool writeBulletins(const string& path, const vector<string>& lines) {
+    StringArena text;
+    string data;
+    for (size_t i = 0; i < lines.size(); ++i) {
+        Bulletin bulletin;
+        string error;
+        if (!parseBulletin(lines[i], bulletin, text, error)) {
+            cout << "Error: Bulletin " << i + 1 << ": " << error << "." << endl;
+            return false;
+        }
+        data += lines[i];
+        data += '\n';
+    }
+    FILE* file = fopen(path.c_str(), "ab");
+    if (!file) {
+        cout << "Error: Cannot open bulletin log '" << path << "'." << endl;
+        return false;
+    }
+    bool ok = fwrite(data.data(), 1, data.size(), file) == data.size() && fflush(file) == 0;
+#ifdef _WIN32
+    ok = ok && _commit(_fileno(file)) == 0;
+#else
+    ok = ok && fsync(fileno(file)) == 0;
+#endif
+    ok = fclose(file) == 0 && ok;
+    if (!ok) cout << "Error: Cannot write bulletin log '" << path << "'." << endl;
+    return ok;
+}
+
+// Dataset snapshots for concurrent readers (the server). A snapshot is never changed once
+// published: a batch of bulletins builds the next snapshot and swaps the atomic current pointer
+// to it. Snapshots share their tables through shared_ptr; a batch copies only the year tables it
+// changes and reuses the others.
+//
+// Readers never take a mutex. A ReadGuard pins the current epoch in a free reader slot, then
+// loads the pointer. A writer retires the snapshot it replaced under the epoch it then closes,
+// and frees it once no slot pins that epoch or an earlier one. A reader that loaded the old
+// pointer had pinned its epoch before, so the writer sees the pin (epoch-based reclamation).
+struct DatasetSnapshot {
+    uint64_t version = 0;
+    map<int, shared_ptr<const TyphoonTable>> years;
+    TyphoonDataset dataset; // the year tables, oldest first
+};
+
+class SnapshotStore {
+    // One cache line per slot, so readers pinning side by side do not contend
+    struct alignas(64) ReaderSlot {
+        atomic<uint64_t> pinnedEpoch{0}; // 0 = free
+    };
+
+public:
+    static const size_t MAX_READERS = 256; // readers past this many wait for a free slot
+
+    explicit SnapshotStore(map<int, shared_ptr<const TyphoonTable>> years);
+    SnapshotStore(const SnapshotStore&) = delete;
+    SnapshotStore& operator=(const SnapshotStore&) = delete;
+    ~SnapshotStore() { delete current.load(); } // no reader may still hold a guard
+
+    // The snapshot that was current when the guard was made, kept alive until the guard ends
+    class ReadGuard {
+    public:
+        explicit ReadGuard(const SnapshotStore& store);
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+        ~ReadGuard() { slot->pinnedEpoch.store(0, memory_order_release); }
+        const DatasetSnapshot& operator*() const { return *snapshot; }
+        const DatasetSnapshot* operator->() const { return snapshot; }
+
+    private:
+        ReaderSlot* slot;
+        const DatasetSnapshot* snapshot;
+    };
+
+    size_t applyBulletins(BulletinLog& log);
+
+private:
+    void publish(unique_ptr<DatasetSnapshot> next);
+    void reclaim();
+
+    atomic<const DatasetSnapshot*> current{nullptr};
+    atomic<uint64_t> epoch{1};
+    mutable ReaderSlot readers[MAX_READERS];
+    mutex writerMutex; // orders writers; readers never touch it
+    vector<pair<uint64_t, unique_ptr<const DatasetSnapshot>>> retired; // with the epoch they were retired in
+};
+
+// Function to chain a snapshot's year tables into its dataset
+void chainSnapshot(DatasetSnapshot& snapshot) {
+    snapshot.dataset = TyphoonDataset();
+    for (const auto& year : snapshot.years) snapshot.dataset.add(*year.second);
+}
+
+SnapshotStore::SnapshotStore(map<int, shared_ptr<const TyphoonTable>> years) {
+    unique_ptr<DatasetSnapshot> first(new DatasetSnapshot);
+    first->years = move(years);
+    chainSnapshot(*first);
+    current.store(first.release());
+}
+
+SnapshotStore::ReadGuard::ReadGuard(const SnapshotStore& store) {
+    // Start from a slot picked by thread so concurrent readers seldom try the same one
+    size_t s = hash<thread::id>()(this_thread::get_id()) % MAX_READERS;
+    for (;; s = (s + 1) % MAX_READERS) {
+        uint64_t free = 0;
+        atomic<uint64_t>& pin = store.readers[s].pinnedEpoch;
+        if (pin.load(memory_order_relaxed) == 0 && pin.compare_exchange_strong(free, store.epoch.load())) break;
+    }
+    slot = &store.readers[s];
+    snapshot = store.current.load();
+}
+
+// Function to apply the bulletins logged since the last call as one new snapshot; returns how
+// many were applied. Each changed year's table is copied once per batch, before its first change.
+size_t SnapshotStore::applyBulletins(BulletinLog& log) {
+    lock_guard<mutex> lock(writerMutex);
+    ScopedTimer timer(STAT_PUBLISH_SNAPSHOT);
+    const DatasetSnapshot& base = *current.load();
+    map<int, shared_ptr<TyphoonTable>> copies;
+    BulletinTarget target;
+    target.writableYear = [&](int year, bool create) -> TyphoonTable* {
+        auto copy = copies.find(year);
+        if (copy != copies.end()) return copy->second.get();
+        auto shared = base.years.find(year);
+        if (shared == base.years.end() && !create) return nullptr;
+        shared_ptr<TyphoonTable> table = shared != base.years.end() ? make_shared<TyphoonTable>(shared->second->clone())
+                                                                    : make_shared<TyphoonTable>();
+        return (copies[year] = move(table)).get();
+    };
+    const size_t applied = log.poll(target);
+    if (applied > 0) {
+        unique_ptr<DatasetSnapshot> next(new DatasetSnapshot);
+        next->version = base.version + 1;
+        next->years = base.years;
+        for (auto& copy : copies) next->years[copy.first] = move(copy.second);
+        chainSnapshot(*next);
+        timer.addItems(copies.size());
+        publish(move(next));
+    } else {
+        reclaim();
+    }
+    return applied;
+}
+
+// Function to make next the current snapshot and retire the one it replaces
+void SnapshotStore::publish(unique_ptr<DatasetSnapshot> next) {
+    const DatasetSnapshot* replaced = current.exchange(next.release());
+    retired.emplace_back(epoch.fetch_add(1), unique_ptr<const DatasetSnapshot>(replaced));
+    reclaim();
+}
+
+// Function to free the retired snapshots no reader can still hold: those retired in an epoch
+// before the oldest one pinned
+void SnapshotStore::reclaim() {
+    uint64_t oldestPinned = numeric_limits<uint64_t>::max();
+    for (const ReaderSlot& slot : readers) {
+        const uint64_t pinned = slot.pinnedEpoch.load();
+        if (pinned) oldestPinned = min(oldestPinned, pinned);
+    }
+    retired.erase(remove_if(retired.begin(), retired.end(),
+                            [&](const pair<uint64_t, unique_ptr<const DatasetSnapshot>>& r) { return r.first < oldestPinned; }),
+                  retired.end());
+}
+
+// Function to read a month given as a number (1-12), an English name or its abbreviation, 0 when invalid
+int parseMonthToken(const string& token) {
+    int month = 0;
+    auto res = from_chars(token.data(), token.data() + token.size(), month);
+    if (res.ec == errc() && res.ptr == token.data() + token.size()) return (month >= 1 && month <= 12) ? month : 0;
+    static const char* const names[] = {"january", "february", "march", "april", "may", "june", "july",
+                                        "august", "september", "october", "november", "december"};
+    const string name = normalizedLower(token);
+    for (int m = 0; m < 12 && name.size() >= 3; ++m) {
+        if (string(names[m]).compare(0, name.size(), name) == 0) return m + 1;
+    }
+    return 0;
+}
+
+// Functions giving the next representable value, so "x>5" narrows to the same range as "x>=next"
+inline int nextAbove(int value) { return value + 1; }
+inline int nextBelow(int value) { return value - 1; }
+inline double nextAbove(double value) { return nextafter(value, numeric_limits<double>::infinity()); }
+inline double nextBelow(double value) { return nextafter(value, -numeric_limits<double>::infinity()); }
+
+// Function to narrow a [low, high] range by a comparison, false for an unknown operator
+template <typename T>
+bool applyRange(const string& op, T value, T& low, T& high) {
+    if (op == "=" || op == "==") { low = max(low, value); high = min(high, value); }
+    else if (op == ">=") low = max(low, value);
+    else if (op == ">") low = max(low, nextAbove(value));
+    else if (op == "<=") high = min(high, value);
+    else if (op == "<") high = min(high, nextBelow(value));
+    else return false;
+    return true;
+}
+
+// Function to read a YYYY-MM-DD date as minutes since epoch (start of day), NO_TIMESTAMP if invalid
+int32_t parseQueryDate(const string& text) {
+    int year = 0, month = 0, day = 0;
+    char tail;
+    if (sscanf(text.c_str(), "%d-%d-%d%c", &year, &month, &day, &tail) != 3) return NO_TIMESTAMP;
+    if (month < 1 || month > 12 || day < 1 || day > 31) return NO_TIMESTAMP;
+    return daysFromCivil(year, month, day) * 1440;
+}
+
+// Function to add a predicate token such as "wind>=150", "level=super_typhoon" or "from=2024-07-01"
+// to the query. Returns false when the token is not a predicate; sets error when it is but is invalid.
+// field receives the predicate's field name in lower case.
+bool parsePredicate(const string& token, TyphoonQuery& query, string& field, string& error) {
+    size_t pos = 0;
+    while (pos < token.size() && isalpha(static_cast<unsigned char>(token[pos]))) ++pos;
+    field = normalizedLower(token.substr(0, pos));
+    string op;
+    while (pos < token.size() && strchr("<>=!", token[pos])) op += token[pos++];
+    if (field.empty() || op.empty()) return false;
+    string value = token.substr(pos);
+    replace(value.begin(), value.end(), '_', ' ');
+    const char* first = value.data();
+    const char* last = value.data() + value.size();
+
+    if (field == "year" || field == "wind") {
+        int number = 0;
+        auto res = from_chars(first, last, number);
+        int& low = field == "year" ? query.yearMin : query.windMin;
+        int& high = field == "year" ? query.yearMax : query.windMax;
+        if (res.ec != errc() || res.ptr != last || !applyRange(op, number, low, high)) error = "invalid filter '" + token + "'";
+    } else if (field == "damages") {
+        char* end = nullptr;
+        const double number = strtod(value.c_str(), &end);
+        if (value.empty() || end != value.c_str() + value.size() ||
+            !applyRange(op, number, query.damagesMin, query.damagesMax)) error = "invalid filter '" + token + "'";
+    } else if (op != "=") {
+        error = "'" + field + "' only supports '='";
+    } else if (field == "crossing") {
+        query.crossing = canonicalCrossing(value);
+    } else if (field == "developed") {
+        const string key = normalizedLower(value);
+        query.developed = canonicalDeveloped(key == "within" || key == "outside" ? key + " the par" : value);
+    } else if (field == "level") {
+        query.level = canonicalLevel(value);
+    } else if (field == "place") {
+        vector<string> places;
+        canonicalPlaces(value, places);
+        if (places.empty()) error = "invalid place '" + value + "'";
+        else query.place = places.front();
+    } else if (field == "from" || field == "to") {
+        int32_t day = parseQueryDate(value);
+        if (day == NO_TIMESTAMP) error = "invalid date '" + value + "', expected YYYY-MM-DD";
+        else if (field == "from") query.arrivalFrom = day;
+        else query.arrivalTo = day + 1439;
+    } else {
+        error = "unknown filter '" + field + "'";
+    }
+    return true;
+}
+
+// The storms of a dataset from years in [low, high]. Tables whose years all fall in the range are
+// shared; a table holding years on both sides of a bound (a whole-archive table, or a row whose
+// year a bulletin changed) contributes a copy of its rows in range.
+struct YearSelection {
+    TyphoonDataset dataset;
+    deque<TyphoonTable> partial; // the copies; a deque, so they never move
+};
+
+// Function to select the storms of a dataset from years in [low, high], row by row
+void selectYears(const TyphoonDataset& dataset, int low, int high, YearSelection& selection) {
+    for (size_t t = 0; t < dataset.tableCount(); ++t) {
+        const TyphoonTable& table = dataset.table(t);
+        if (table.empty()) continue;
+        const int first = table.indexYears.front(), last = table.indexYears.back();
+        if (last < low || first > high) continue;
+        if (first >= low && last <= high) {
+            selection.dataset.add(table);
+            continue;
+        }
+        vector<Typhoon> rows;
+        for (size_t i = 0; i < table.size(); ++i) {
+            if (table.year[i] >= low && table.year[i] <= high) rows.push_back(table.record(i));
+        }
+        selection.partial.push_back(buildTable(move(rows), false));
+        selection.dataset.add(selection.partial.back());
+    }
+}
+
+// Function to print the query language summary
+void reportQueryHelp(ReportWriter& report) {
+    report << "Queries (year filters such as year>=2000, year<2025 or year=2024 may follow any query):\n"
+           << "  list [field,field,...] <filters>             matching typhoons with the chosen fields\n"
+           << "  stats [year|month|level|region] <filters>    count, damages, casualties and peak wind\n"
+           << "  top <wind|casualties|damages|duration> [K]   strongest K typhoons (default 3)\n"
+           << "  most-damaging                                typhoon with the highest damages\n"
+           << "  names                                        all names, A-Z\n"
+           << "  name <name>                                  find a typhoon by name, name start or close spelling\n"
+           << "  longest-stay                                 typhoon with the longest stay\n"
+           << "  landfall                                     typhoons that made landfall\n"
+           << "  month <1-12|name>                            full details for one month\n"
+           << "  place <province or region>                   typhoons that hit a place\n"
+           << "  places-months <N>                            places hit in more than N months\n"
+           << "  resolutions <year>                           resolutions / recommendations\n"
+           << "  help                                         this summary\n"
+           << "Filters for list/stats: wind>=N wind<N damages>=X crossing=land|water developed=within|outside\n"
+           << "  level=typhoon (spaces as _) place=Camarines_Sur from=YYYY-MM-DD to=YYYY-MM-DD (arrival date)\n"
+           << "Fields: name year month wind casualties damages level crossing developed stay places\n";
+}
+
+// Function to answer one batch query against the dataset, false if the query could not be understood
+bool executeQuery(ReportWriter& report, const TyphoonDataset& dataset, const string& query) {
+    vector<string> words;
+    istringstream in(query);
+    string word, field, error;
+    TyphoonQuery filter;
+    bool rowFilters = false;
+    while (in >> word) {
+        if (!parsePredicate(word, filter, field, error)) {
+            words.push_back(word);
+        } else if (!error.empty()) {
+            report << "Error: " << error << '\n';
+            return false;
+        } else if (field != "year") {
+            rowFilters = true;
+        }
+    }
+    if (words.empty()) return true;
+    YearSelection years;
+    selectYears(dataset, filter.yearMin, filter.yearMax, years);
+    const TyphoonDataset& selected = years.dataset;
+
+    const string command = normalizedLower(words[0]);
+    const size_t args = words.size() - 1;
+    if (rowFilters && command != "list" && command != "stats") {
+        report << "Error: only list and stats accept filters other than year\n";
+        return false;
+    }
+    if (command == "help") {
+        reportQueryHelp(report);
+    } else if (command == "list" && args <= 1) {
+        filter.fields = {FIELD_NAME, FIELD_YEAR, FIELD_MONTH, FIELD_LEVEL, FIELD_WIND};
+        if (args == 1) {
+            filter.fields.clear();
+            size_t start = 0;
+            while (start <= words[1].size()) {
+                size_t comma = words[1].find(',', start);
+                if (comma == string::npos) comma = words[1].size();
+                const string name = normalizedLower(words[1].substr(start, comma - start));
+                int f = 0;
+                while (f < QUERY_FIELD_COUNT && name != QUERY_FIELD_NAMES[f]) ++f;
+                if (f == QUERY_FIELD_COUNT) {
+                    report << "Error: unknown field '" << name << "'\n";
+                    return false;
+                }
+                filter.fields.push_back(static_cast<QueryField>(f));
+                start = comma + 1;
+            }
+        }
+        reportSelection(report, selected, filter);
+    } else if (command == "stats" && args <= 1) {
+        static const char* const groupNames[] = {"", "year", "month", "level", "region"};
+        const string group = args == 1 ? normalizedLower(words[1]) : "";
+        int g = 0;
+        while (g < 5 && group != groupNames[g]) ++g;
+        if (g == 5) {
+            report << "Error: expected stats [year|month|level|region]\n";
+            return false;
+        }
+        filter.groupBy = static_cast<GroupBy>(g);
+        reportAggregate(report, selected, filter);
+    } else if (command == "resolutions" && args == 1) {
+        reportResolutions(report, atoi(words[1].c_str()));
+    } else if (selected.empty()) {
+        report << "No typhoon data available.\n";
+    } else if (command == "top" && (args == 1 || args == 2)) {
+        static const char* const keyNames[] = {"wind", "casualties", "damages", "duration"};
+        const string key = normalizedLower(words[1]);
+        int rankKey = 0;
+        while (rankKey < 4 && key != keyNames[rankKey]) ++rankKey;
+        size_t k = 3;
+        if (args == 2) {
+            auto res = from_chars(words[2].data(), words[2].data() + words[2].size(), k);
+            if (res.ec != errc() || res.ptr != words[2].data() + words[2].size() || k == 0) rankKey = 4;
+        }
+        if (rankKey == 4) {
+            report << "Error: expected top <wind|casualties|damages|duration> [K], K >= 1\n";
+            return false;
+        }
+        reportTopK(report, selected, static_cast<RankKey>(rankKey), k);
+    } else if (command == "most-damaging" && args == 0) {
+        reportMostDamaging(report, selected);
+    } else if (command == "names" && args == 0) {
+        reportAlphabetical(report, selected);
+    } else if (command == "name" && args >= 1) {
+        string name = words[1];
+        for (size_t i = 2; i < words.size(); ++i) name += " " + words[i];
+        reportNameSearch(report, selected, name);
+    } else if (command == "longest-stay" && args == 0) {
+        reportLongestStay(report, selected);
+    } else if (command == "landfall" && args == 0) {
+        reportLandfall(report, selected);
+    } else if (command == "month" && args == 1) {
+        const int month = parseMonthToken(words[1]);
+        if (month == 0) {
+            report << "Error: invalid month '" << words[1] << "'\n";
+            return false;
+        }
+        reportMonth(report, selected, month);
+    } else if (command == "place" && args >= 1) {
+        string place = words[1];
+        for (size_t i = 2; i < words.size(); ++i) place += " " + words[i];
+        reportByPlace(report, selected, place);
+    } else if (command == "places-months" && args == 1) {
+        int threshold = 0;
+        auto res = from_chars(words[1].data(), words[1].data() + words[1].size(), threshold);
+        if (res.ec != errc() || res.ptr != words[1].data() + words[1].size()) {
+            report << "Error: expected places-months <N>\n";
+            return false;
+        }
+        reportPlacesHitInMonths(report, selected, threshold);
+    } else {
+        report << "Error: unknown query '" << query << "' (try 'help')\n";
+        return false;
+    }
+    return true;
+}
+
+// Function to get the column groups a query's answer can depend on, from its words. Year
+// filters read the dates; list, stats, month and name show whole records.
+unsigned queryColumns(const string& query) {
+    static const pair<const char*, unsigned> commands[] = {
+        {"help", 0}, {"resolutions", 0}, {"most-damaging", COLUMNS_NAME | COLUMNS_DAMAGES}, {"names", COLUMNS_NAME},
+        {"longest-stay", COLUMNS_NAME}, {"landfall", COLUMNS_NAME | COLUMNS_CLASS},
+        {"place", COLUMNS_NAME | COLUMNS_PLACES}, {"places-months", COLUMNS_PLACES},
+    };
+    static const pair<const char*, unsigned> rankKeys[] = {
+        {"wind", COLUMNS_WIND}, {"casualties", COLUMNS_CASUALTIES}, {"damages", COLUMNS_DAMAGES}, {"duration", 0},
+    };
+    istringstream in(query);
+    string command, word;
+    in >> command;
+    command = normalizedLower(command);
+    if (command == "top") {
+        unsigned columns = COLUMNS_NAME | COLUMNS_DATES;
+        bool ranked = false;
+        while (in >> word) {
+            for (const auto& key : rankKeys) {
+                if (normalizedLower(word) == key.first) {
+                    columns |= key.second;
+                    ranked = true;
+                }
+            }
+        }
+        return ranked ? columns : COLUMNS_ALL;
+    }
+    for (const auto& entry : commands) {
+        if (command == entry.first) return entry.second | COLUMNS_DATES;
+    }
+    return COLUMNS_ALL;
+}
+
+// Function to run one batch query, replaying its answer from the result cache while no storm it
+// could read has changed; false if the query could not be understood
+bool runQuery(ReportWriter& report, const TyphoonDataset& dataset, const string& query) {
+    ScopedTimer timer(STAT_QUERY);
+    timer.addItems(dataset.size());
+    bool ok = true;
+    resultCache.write(report, datasetKey("query " + query, dataset), datasetDependencies(dataset, queryColumns(query)),
+                      [&](ReportWriter& out) { return ok = executeQuery(out, dataset, query); });
+    return ok;
+}
+
+// HTTP/JSON server. `serve` answers GET requests on a local port, each from the dataset snapshot
+// current when it arrives, without locks; bulletins logged while serving come in as new
+// snapshots. Every worker runs its own event loop, polling the shared listening socket and the
+// keep-alive connections it accepted, and runs the scans of a request on its own thread.
+#ifdef _WIN32
+typedef SOCKET SocketHandle;
+const SocketHandle NO_SOCKET = INVALID_SOCKET;
+inline void closeSocket(SocketHandle s) { closesocket(s); }
+#else
+typedef int SocketHandle;
+const SocketHandle NO_SOCKET = -1;
+inline void closeSocket(SocketHandle s) { close(s); }
+#endif
+
+const size_t MAX_REQUEST_HEAD = 16 << 10;
+const size_t MAX_QUEUED_RESPONSES = 64 << 10; // pipelined requests wait while this much is unsent
+const int KEEP_ALIVE_MS = 5000; // idle connections are closed after this long
+const int SOCKET_POLL_MS = 200; // how often idle workers check for a stop request
+const int BULLETIN_POLL_MS = 1000; // how often the bulletin log is checked for new lines
+
+atomic<bool> stopServing{false};
+
+// Function to stop the server at SIGINT/SIGTERM; workers notice within SOCKET_POLL_MS
+extern "C" void requestServerStop(int) { stopServing = true; }
+
+// Function to prepare the socket library. Winsock has to be started; elsewhere a peer that hangs
+// up mid-response must not end the process with SIGPIPE.
+bool startSockets() {
+#ifdef _WIN32
+    WSADATA data;
+    return WSAStartup(MAKEWORD(2, 2), &data) == 0;
+#else
+    signal(SIGPIPE, SIG_IGN);
+    return true;
+#endif
+}
+
+// Function to switch a socket between blocking and non-blocking calls
+bool setBlocking(SocketHandle s, bool blocking) {
+#ifdef _WIN32
+    u_long nonBlocking = blocking ? 0 : 1;
+    return ioctlsocket(s, FIONBIO, &nonBlocking) == 0;
+#else
+    const int flags = fcntl(s, F_GETFL, 0);
+    return flags != -1 && fcntl(s, F_SETFL, blocking ? flags & ~O_NONBLOCK : flags | O_NONBLOCK) == 0;
+#endif
+}
+
+// Function to turn off Nagle's delay; requests and responses are written whole
+void setNoDelay(SocketHandle s) {
+    int on = 1;
+    setsockopt(s, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&on), sizeof(on));
+}
+
+// Function to open a TCP socket listening on host:port, or connected to it; NO_SOCKET on failure
+SocketHandle openSocket(const string& host, int port, bool listening) {
+    addrinfo hints = {};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = listening ? AI_PASSIVE : 0;
+    addrinfo* found = nullptr;
+    const string service = to_string(port);
+    if (getaddrinfo(host.empty() ? nullptr : host.c_str(), service.c_str(), &hints, &found) != 0) return NO_SOCKET;
+    SocketHandle s = NO_SOCKET;
+    for (addrinfo* a = found; a && s == NO_SOCKET; a = a->ai_next) {
+        s = socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+        if (s == NO_SOCKET) continue;
+        int on = 1;
+        if (listening) setsockopt(s, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&on), sizeof(on));
+        const bool ok = listening ? bind(s, a->ai_addr, a->ai_addrlen) == 0 && listen(s, SOMAXCONN) == 0
+                                  : connect(s, a->ai_addr, a->ai_addrlen) == 0;
+        if (!ok) {
+            closeSocket(s);
+            s = NO_SOCKET;
+        }
+    }
+    freeaddrinfo(found);
+    if (s != NO_SOCKET) setNoDelay(s);
+    return s;
+}
+
+// Function to wait up to ms milliseconds for any of the sockets to have data, or a connection,
+// to read; sets their revents and returns how many are ready
+int pollSockets(vector<pollfd>& sockets, int ms) {
+#ifdef _WIN32
+    return WSAPoll(sockets.data(), static_cast<ULONG>(sockets.size()), ms);
+#else
+    return poll(sockets.data(), sockets.size(), ms);
+#endif
+}
+
+// Function to wait up to ms milliseconds until a socket has data to read
+bool waitReadable(SocketHandle s, int ms) {
+    vector<pollfd> entry(1);
+    entry[0].fd = s;
+    entry[0].events = POLLIN;
+    return pollSockets(entry, ms) > 0;
+}
+
+// Function to tell whether the last call on a non-blocking socket failed only because it would
+// have had to wait
+bool socketWouldBlock() {
+#ifdef _WIN32
+    return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+    return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+#endif
+}
+
+// Function to send all of data, false once the peer is gone
+bool sendAll(SocketHandle s, string_view data) {
+    while (!data.empty()) {
+        const auto sent = send(s, data.data(), static_cast<int>(min<size_t>(data.size(), 1 << 30)), 0);
+        if (sent <= 0) return false;
+        data.remove_prefix(sent);
+    }
+    return true;
+}
+
+// Function to append whatever arrives within ms milliseconds to pending: the byte count, 0 when
+// nothing came in time, -1 once the peer has closed the connection
+long receiveSome(SocketHandle s, string& pending, int ms) {
+    if (!waitReadable(s, ms)) return 0;
+    char buffer[16 << 10];
+    const auto got = recv(s, buffer, static_cast<int>(sizeof(buffer)), 0);
+    if (got <= 0) return -1;
+    pending.append(buffer, got);
+    return long(got);
+}
+
+struct HttpRequest {
+    string method;
+    string path;
+    vector<pair<string, string>> params; // decoded query string, in order
+    bool keepAlive = true;
+
+    // Function to get a query parameter, nullptr when it is not given
+    const string* param(const char* key) const {
+        for (const auto& p : params) {
+            if (p.first == key) return &p.second;
+        }
+        return nullptr;
+    }
+};
+
+// Function to get the value of a hex digit, -1 if c is not one
+int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    c = static_cast<char>(c | 0x20);
+    return c >= 'a' && c <= 'f' ? c - 'a' + 10 : -1;
+}
+
+// Function to undo the %XX escapes, and '+' for space, of a URL query component
+string urlDecode(string_view text) {
+    string decoded;
+    decoded.reserve(text.size());
+    for (size_t i = 0; i < text.size(); ++i) {
+        if (text[i] == '+') {
+            decoded += ' ';
+        } else if (text[i] == '%' && i + 2 < text.size() && hexValue(text[i + 1]) >= 0 && hexValue(text[i + 2]) >= 0) {
+            decoded += static_cast<char>(hexValue(text[i + 1]) * 16 + hexValue(text[i + 2]));
+            i += 2;
+        } else {
+            decoded += text[i];
+        }
+    }
+    return decoded;
+}
+
+// Function to parse a request head (request line and headers, without the blank line); false if
+// it is not HTTP
+bool parseHttpRequest(string_view head, HttpRequest& request) {
+    size_t lineEnd = head.find("\r\n");
+    const string_view requestLine = head.substr(0, lineEnd);
+    const size_t methodEnd = requestLine.find(' ');
+    const size_t targetEnd = requestLine.rfind(' ');
+    if (methodEnd == string_view::npos || targetEnd <= methodEnd) return false;
+    const string_view version = requestLine.substr(targetEnd + 1);
+    if (version.compare(0, 5, "HTTP/") != 0) return false;
+    request.method = string(requestLine.substr(0, methodEnd));
+    const string_view target = requestLine.substr(methodEnd + 1, targetEnd - methodEnd - 1);
+    const size_t question = target.find('?');
+    request.path = urlDecode(target.substr(0, question));
+    if (question != string_view::npos) {
+        string_view query = target.substr(question + 1);
+        while (!query.empty()) {
+            const size_t amp = min(query.find('&'), query.size());
+            const string_view field = query.substr(0, amp);
+            const size_t equals = min(field.find('='), field.size());
+            if (!field.empty()) {
+                request.params.emplace_back(urlDecode(field.substr(0, equals)),
+                                            urlDecode(field.substr(min(equals + 1, field.size()))));
+            }
+            query.remove_prefix(min(amp + 1, query.size()));
+        }
+    }
+    // HTTP/1.1 keeps the connection unless told otherwise, HTTP/1.0 closes it unless asked not to
+    request.keepAlive = version != "HTTP/1.0";
+    while (lineEnd != string_view::npos) {
+        const size_t start = lineEnd + 2;
+        lineEnd = head.find("\r\n", start);
+        const string_view header = head.substr(start, lineEnd == string_view::npos ? string_view::npos : lineEnd - start);
+        const size_t colon = header.find(':');
+        if (colon == string_view::npos || normalizedLower(header.substr(0, colon)) != "connection") continue;
+        const string value = normalizedLower(header.substr(colon + 1));
+        if (value.find("close") != string::npos) request.keepAlive = false;
+        if (value.find("keep-alive") != string::npos) request.keepAlive = true;
+    }
+    return true;
+}
+
+// Function to format a complete response with a JSON body
+string httpResponse(int status, const string& body, bool keepAlive) {
+    const char* reason = status == 200 ? "OK" : status == 400 ? "Bad Request" : status == 404 ? "Not Found"
+                       : status == 405 ? "Method Not Allowed" : "Request Header Fields Too Large";
+    char head[192];
+    const int n = snprintf(head, sizeof(head),
+                           "HTTP/1.1 %d %s\r\nContent-Type: application/json\r\nContent-Length: %zu\r\nConnection: %s\r\n\r\n",
+                           status, reason, body.size(), keepAlive ? "keep-alive" : "close");
+    string response;
+    response.reserve(n + body.size());
+    response.append(head, n);
+    response += body;
+    return response;
+}
+
+// Function to write text as a JSON string
+void jsonString(ReportWriter& out, string_view text) {
+    out << '"';
+    for (char c : text) {
+        switch (c) {
+            case '"': out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            case '\r': out << "\\r"; break;
+            case '\t': out << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char escaped[8];
+                    snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                    out << escaped;
+                } else {
+                    out << c;
+                }
+        }
+    }
+    out << '"';
+}
+
+// Function to write one typhoon's record as a JSON object, with the provinces and regions its
+// places text resolves to as an array
+void renderTyphoonJson(ReportWriter& out, const TyphoonTable& table, size_t i) {
+    out << "{\"name\": ";
+    jsonString(out, table.name[i]);
+    out << ", \"year\": " << table.year[i] << ", \"month\": ";
+    jsonString(out, table.month[i]);
+    out << ", \"arrival\": ";
+    jsonString(out, table.arrival[i]);
+    out << ", \"departure\": ";
+    jsonString(out, table.departure[i]);
+    out << ", \"interval\": ";
+    jsonString(out, table.interval[i]);
+    out << ", \"stormCrossing\": ";
+    jsonString(out, table.stormCrossingText(i));
+    out << ", \"timeOfLandfall\": ";
+    jsonString(out, table.timeOfLandfall[i]);
+    out << ", \"developed\": ";
+    jsonString(out, table.developedText(i));
+    out << ", \"pathType\": ";
+    jsonString(out, table.pathTypeText(i));
+    out << ", \"level\": ";
+    jsonString(out, table.levelsText(i));
+    out << ", \"windSpeed\": " << table.windSpeed[i] << ", \"casualties\": " << table.casualties[i] << ", \"damages\": ";
+    out.money(table.damages[i]) << ", \"placesAffected\": ";
+    jsonString(out, table.placesAffected[i]);
+    out << ", \"places\": [";
+    const uint64_t* bits = table.placeRow(i);
+    bool first = true;
+    for (size_t w = 0; w < table.placeWords; ++w) {
+        for (uint64_t word = bits[w]; word; word &= word - 1) {
+            if (!first) out << ", ";
+            jsonString(out, table.placeNames.text(static_cast<uint16_t>(w * 64 + countTrailingZeros(word))));
+            first = false;
+        }
+    }
+    out << "]}";
+}
+
+// Function to write {"error": message} and return the status to send it with
+int jsonError(ReportWriter& out, int status, const string& message) {
+    out << "{\"error\": ";
+    jsonString(out, message);
+    out << "}\n";
+    return status;
+}
+
+// Function to read an integer parameter into value, left alone when absent; false if malformed
+bool intParam(const HttpRequest& request, const char* key, int& value) {
+    const string* text = request.param(key);
+    if (!text) return true;
+    auto res = from_chars(text->data(), text->data() + text->size(), value);
+    return res.ec == errc() && res.ptr == text->data() + text->size();
+}
+
+// Function to answer GET /month?month=<1-12|name>: full records of that month
+int answerMonth(ReportWriter& out, const TyphoonDataset& selected, int low, int high, const HttpRequest& request) {
+    const string* monthText = request.param("month");
+    const int month = monthText ? parseMonthToken(*monthText) : 0;
+    if (month == 0) return jsonError(out, 400, "expected month=<1-12|name>");
+    out << "{\"month\": " << month << ", \"typhoons\": [";
+    size_t shown = 0;
+    for (size_t t = 0; t < selected.tableCount(); ++t) {
+        const TyphoonTable& table = selected.table(t);
+        for (int year : table.indexYears) {
+            if (year < low || year > high) continue;
+            for (uint32_t i : getTyphoonsForMonth(table, year, month)) {
+                out << (shown++ ? ",\n  " : "\n  ");
+                renderTyphoonJson(out, table, i);
+            }
+        }
+    }
+    out << "], \"count\": " << shown << "}\n";
+    return 200;
+}
+
+// Function to answer GET /top?by=<wind|casualties|damages|duration>&k=<K>: a ranking, K defaults to 3
+int answerTop(ReportWriter& out, const TyphoonDataset& selected, const HttpRequest& request) {
+    static const char* const keyNames[] = {"wind", "casualties", "damages", "duration"};
+    static const char* const units[] = {"km/h", "casualties", "Peso", "hours"};
+    const string* by = request.param("by");
+    int key = 0;
+    while (key < 4 && (!by || normalizedLower(*by) != keyNames[key])) ++key;
+    int k = 3;
+    if (key == 4 || !intParam(request, "k", k) || k <= 0) {
+        return jsonError(out, 400, "expected by=<wind|casualties|damages|duration> and k=<K>, K >= 1");
+    }
+    const vector<RankedRow> ranked = rankTyphoons(selected, static_cast<RankKey>(key), min(size_t(k), selected.size()));
+    out << "{\"by\": \"" << keyNames[key] << "\", \"unit\": \"" << units[key] << "\", \"typhoons\": [";
+    for (size_t r = 0; r < ranked.size(); ++r) {
+        TyphoonDataset::RowRef ref = selected.locate(ranked[r].row);
+        out << (r ? ",\n  " : "\n  ") << "{\"rank\": " << (r + 1) << ", \"name\": ";
+        jsonString(out, ref.table->name[ref.row]);
+        out << ", \"year\": " << ref.table->year[ref.row] << ", \"month\": ";
+        jsonString(out, ref.table->month[ref.row]);
+        out << ", \"value\": ";
+        if (key == RANK_DAMAGES) out.money(ref.table->damages[ref.row]);
+        else out << static_cast<long long>(rankKeyValue(*ref.table, ref.row, static_cast<RankKey>(key)));
+        out << '}';
+    }
+    out << "]}\n";
+    return 200;
+}
+
+// Function to answer GET /place?name=<province or region>: the typhoons that hit it
+int answerPlace(ReportWriter& out, const TyphoonDataset& selected, const HttpRequest& request) {
+    const string* name = request.param("name");
+    vector<string> places;
+    if (name) canonicalPlaces(*name, places);
+    if (places.empty()) return jsonError(out, 400, "expected name=<province or region>");
+    TyphoonQuery hitPlace;
+    hitPlace.place = places.front();
+    out << "{\"place\": ";
+    jsonString(out, places.front());
+    out << ", \"typhoons\": [";
+    size_t hits = 0;
+    forEachMatch(selected, hitPlace, [&](const TyphoonTable& table, uint32_t i) {
+        out << (hits++ ? ",\n  " : "\n  ") << "{\"name\": ";
+        jsonString(out, table.name[i]);
+        out << ", \"year\": " << table.year[i] << ", \"month\": ";
+        jsonString(out, table.month[i]);
+        out << '}';
+    });
+    out << "], \"count\": " << hits << "}\n";
+    return 200;
+}
+
+// Function to answer GET /resolutions?year=<year>; a year without resolutions has no sections
+int answerResolutions(ReportWriter& out, const HttpRequest& request) {
+    int year = 0;
+    if (!request.param("year") || !intParam(request, "year", year)) return jsonError(out, 400, "expected year=<year>");
+    out << "{\"year\": " << year << ", \"sections\": [";
+    if (const YearResolutions* resolutions = findResolutions(year)) {
+        bool first = true;
+        for (const ResolutionSection& section : resolutions->sections) {
+            out << (first ? "\n  " : ",\n  ") << "{\"title\": ";
+            jsonString(out, section.title);
+            out << ", \"points\": [";
+            for (size_t p = 0; p < 5; ++p) {
+                if (p) out << ", ";
+                jsonString(out, section.points[p]);
+            }
+            out << "]}";
+            first = false;
+        }
+    }
+    out << "]}\n";
+    return 200;
+}
+
+// Function to answer GET /query?q=<batch query>: the text a `query` session prints for it
+int answerQuery(ReportWriter& out, const TyphoonDataset& dataset, const HttpRequest& request) {
+    const string* query = request.param("q");
+    if (!query) return jsonError(out, 400, "expected q=<query>");
+    ostringstream text;
+    bool ok;
+    {
+        ReportWriter textReport(text, 4096);
+        ok = executeQuery(textReport, dataset, *query);
+    }
+    out << "{\"query\": ";
+    jsonString(out, *query);
+    out << ", \"ok\": " << (ok ? "true" : "false") << ", \"text\": ";
+    jsonString(out, text.str());
+    out << "}\n";
+    return ok ? 200 : 400;
+}
+
+// Function to answer one request from a snapshot into out and return its HTTP status
+int answerRequest(ReportWriter& out, const DatasetSnapshot& snapshot, const HttpRequest& request) {
+    if (request.method != "GET") return jsonError(out, 405, "only GET is supported");
+    const TyphoonDataset& dataset = snapshot.dataset;
+    const string& path = request.path;
+    if (path == "/") {
+        out << "{\"version\": " << snapshot.version << ", \"typhoons\": " << dataset.size()
+            << ", \"years\": \"" << yearSpan(dataset) << "\", \"unresolvedPlaces\": " << dataset.unresolvedPlaces()
+            << ", \"endpoints\": [\n"
+            << "  \"/month?month=<1-12|name>\",\n"
+            << "  \"/top?by=<wind|casualties|damages|duration>&k=<K>\",\n"
+            << "  \"/place?name=<province or region>\",\n"
+            << "  \"/resolutions?year=<year>\",\n"
+            << "  \"/query?q=<query>\"\n"
+            << "], \"filters\": \"year=<year>, from=<year>, to=<year> on /month, /top and /place\"}\n";
+        return 200;
+    }
+    if (path == "/resolutions") return answerResolutions(out, request);
+    if (path == "/query") return answerQuery(out, dataset, request);
+    if (path != "/month" && path != "/top" && path != "/place") return jsonError(out, 404, "no endpoint " + path);
+
+    int low = numeric_limits<int>::min(), high = numeric_limits<int>::max(), year = 0;
+    if (!intParam(request, "from", low) || !intParam(request, "to", high) || !intParam(request, "year", year)) {
+        return jsonError(out, 400, "year, from and to must be years");
+    }
+    if (request.param("year")) low = high = year;
+    YearSelection years;
+    selectYears(dataset, low, high, years);
+    const TyphoonDataset& selected = years.dataset;
+    if (path == "/month") return answerMonth(out, selected, low, high, request);
+    if (path == "/top") return answerTop(out, selected, request);
+    return answerPlace(out, selected, request);
+}
+
+struct HttpConnection {
+    SocketHandle socket;
+    string pending; // bytes received but not answered yet
+    string outgoing; // responses not fully sent; polled for writing, not reading, until drained
+    size_t sent; // bytes of outgoing already sent
+    bool closing; // close once outgoing has drained
+    chrono::steady_clock::time_point lastActive;
+};
+
+// Function to answer the complete requests received on a connection, in order, queuing the
+// responses in outgoing until MAX_QUEUED_RESPONSES bytes wait. A response that ends the
+// connection stops the answering.
+void answerPending(HttpConnection& connection, const SnapshotStore& store) {
+    string& pending = connection.pending;
+    size_t headEnd;
+    while (!connection.closing && connection.outgoing.size() < MAX_QUEUED_RESPONSES
+           && (headEnd = pending.find("\r\n\r\n")) != string::npos) {
+        HttpRequest request;
+        const bool parsed = parseHttpRequest(string_view(pending).substr(0, headEnd), request);
+        pending.erase(0, headEnd + 4);
+        ostringstream body;
+        int status;
+        {
+            ScopedTimer timer(STAT_HTTP_REQUEST);
+            ReportWriter out(body, 16 << 10);
+            const SnapshotStore::ReadGuard snapshot(store);
+            status = parsed ? answerRequest(out, *snapshot, request) : jsonError(out, 400, "malformed request");
+            out.flush();
+            timer.addItems(body.tellp());
+        }
+        // A request other than GET may carry a body we do not read, so its connection ends here
+        const bool keepAlive = parsed && request.keepAlive && status != 405;
+        connection.outgoing += httpResponse(status, body.str(), keepAlive);
+        connection.closing = !keepAlive;
+    }
+    // Only an unfinished head is left once the loop stops with room in the queue
+    if (!connection.closing && connection.outgoing.size() < MAX_QUEUED_RESPONSES && pending.size() > MAX_REQUEST_HEAD) {
+        connection.outgoing += httpResponse(431, "{\"error\": \"request head too large\"}\n", false);
+        connection.closing = true;
+    }
+}
+
+// Function to send as much of a connection's queued responses as its socket takes without
+// waiting; false once the peer is gone
+bool sendPending(HttpConnection& connection, chrono::steady_clock::time_point now) {
+    while (connection.sent < connection.outgoing.size()) {
+        const size_t left = connection.outgoing.size() - connection.sent;
+        const auto sent = send(connection.socket, connection.outgoing.data() + connection.sent,
+                               static_cast<int>(min<size_t>(left, 1 << 30)), 0);
+        if (sent <= 0) return sent < 0 && socketWouldBlock();
+        connection.sent += sent;
+        connection.lastActive = now;
+    }
+    connection.outgoing.clear();
+    connection.sent = 0;
+    return true;
+}
+
+// Function to run one worker's event loop until the server stops: take new connections from the
+// shared listening socket, answer the requests arriving on this worker's connections and close
+// those idle for KEEP_ALIVE_MS. Client sockets never block: a response the peer does not read
+// yet stays queued on its connection, which is not read or answered further until the response
+// has gone out, and a peer that reads nothing for KEEP_ALIVE_MS is dropped.
+void serveWorker(SocketHandle listener, const SnapshotStore& store) {
+    scanOnCallingThread = true;
+    vector<HttpConnection> connections;
+    vector<pollfd> polled;
+    char buffer[16 << 10];
+    while (!stopServing) {
+        polled.assign(connections.size() + 1, pollfd());
+        polled[0].fd = listener;
+        polled[0].events = POLLIN;
+        for (size_t c = 0; c < connections.size(); ++c) {
+            polled[c + 1].fd = connections[c].socket;
+            polled[c + 1].events = connections[c].outgoing.empty() ? POLLIN : POLLOUT;
+        }
+        if (pollSockets(polled, SOCKET_POLL_MS) < 0) continue;
+
+        const auto now = chrono::steady_clock::now();
+        size_t kept = 0;
+        for (size_t c = 0; c < connections.size(); ++c) {
+            HttpConnection& connection = connections[c];
+            const bool ready = polled[c + 1].revents != 0;
+            bool open = true;
+            if (ready && connection.outgoing.empty()) {
+                const auto got = recv(connection.socket, buffer, static_cast<int>(sizeof(buffer)), 0);
+                if (got > 0) {
+                    connection.pending.append(buffer, got);
+                    connection.lastActive = now;
+                } else {
+                    open = got < 0 && socketWouldBlock();
+                }
+            }
+            // Answer and send until the socket takes no more or no complete request is left
+            while (open && ready) {
+                if (connection.outgoing.empty()) answerPending(connection, store);
+                if (connection.outgoing.empty()) break;
+                open = sendPending(connection, now);
+                if (!connection.outgoing.empty()) break;
+            }
+            if (open && connection.outgoing.empty()) open = !connection.closing;
+            if (open && !ready) open = now - connection.lastActive < chrono::milliseconds(KEEP_ALIVE_MS);
+            if (!open) {
+                closeSocket(connection.socket);
+            } else {
+                if (kept != c) connections[kept] = move(connection);
+                ++kept;
+            }
+        }
+        connections.resize(kept);
+
+        // One connection per round, so a burst of connections spreads over the workers. The
+        // listener is non-blocking: a worker that loses the race for a connection gets nothing.
+        if (polled[0].revents & POLLIN) {
+            SocketHandle client = accept(listener, nullptr, nullptr);
+            if (client != NO_SOCKET) {
+                setBlocking(client, false);
+                setNoDelay(client);
+                connections.push_back({client, string(), string(), 0, false, now});
+            }
+        }
+    }
+    for (HttpConnection& connection : connections) closeSocket(connection.socket);
+}
+
+// Function to serve the store's snapshots on host:port with the given number of workers (0 = one
+// per hardware thread) until SIGINT or SIGTERM. Meanwhile this thread applies the bulletins
+// appended to the log as new snapshots.
+int serveHttp(SnapshotStore& store, BulletinLog& log, const string& host, int port, unsigned workers) {
+    SocketHandle listener = startSockets() ? openSocket(host, port, true) : NO_SOCKET;
+    if (listener == NO_SOCKET || !setBlocking(listener, false)) {
+        cout << "Error: Cannot listen on " << host << ":" << port << "." << endl;
+        if (listener != NO_SOCKET) closeSocket(listener);
+        return 1;
+    }
+    signal(SIGINT, requestServerStop);
+    signal(SIGTERM, requestServerStop);
+    const unsigned count = workers ? workers : max(1u, thread::hardware_concurrency());
+    {
+        const SnapshotStore::ReadGuard snapshot(store);
+        cout << "Serving " << snapshot->dataset.size() << " typhoon(s) on http://" << host << ":" << port << "/ with "
+             << count << " worker(s); Ctrl+C stops." << endl;
+    }
+
+    vector<thread> pool;
+    for (unsigned t = 0; t < count; ++t) pool.emplace_back(serveWorker, listener, cref(store));
+    auto nextPoll = chrono::steady_clock::now();
+    while (!stopServing) {
+        this_thread::sleep_for(chrono::milliseconds(SOCKET_POLL_MS));
+        if (!log.isOpen() || chrono::steady_clock::now() < nextPoll) continue;
+        nextPoll = chrono::steady_clock::now() + chrono::milliseconds(BULLETIN_POLL_MS);
+        if (const size_t applied = store.applyBulletins(log)) {
+            const SnapshotStore::ReadGuard snapshot(store);
+            cout << "Applied " << applied << " bulletin(s); serving version " << snapshot->version << "." << endl;
+        }
+    }
+    for (thread& t : pool) t.join();
+    closeSocket(listener);
+    cout << "Server stopped." << endl;
+    return 0;
+}
+
+// Function to write the collected operation stats as an aligned table or as one JSON object.
+// The table lists the operations that ran; the JSON always lists every operation.
+void writeStats(ostream& out, bool json) {
+    const size_t threads = threadsFor(numeric_limits<size_t>::max());
+    const char* simd = simdLevel == SIMD_AVX2 ? "avx2" : "scalar";
+    char line[256];
+    if (json) {
+        snprintf(line, sizeof(line), "{\"threads\": %zu, \"simd\": \"%s\", \"operations\": [", threads, simd);
+        out << line;
+        for (int id = 0; id < STAT_COUNT; ++id) {
+            const OperationStats& stats = operationStats[id];
+            snprintf(line, sizeof(line),
+                     "%s\n  {\"name\": \"%s\", \"calls\": %llu, \"totalMs\": %.3f, \"meanUs\": %.3f, \"maxUs\": %.3f,"
+                     " \"items\": %llu, \"allocations\": %llu, \"allocatedBytes\": %llu}",
+                     id ? "," : "", STAT_NAMES[id], (unsigned long long)stats.calls, stats.totalNanos / 1e6,
+                     stats.calls ? stats.totalNanos / 1e3 / stats.calls : 0.0, stats.maxNanos / 1e3,
+                     (unsigned long long)stats.items, (unsigned long long)stats.allocations,
+                     (unsigned long long)stats.allocatedBytes);
+            out << line;
+        }
+        out << "\n]}" << endl;
+        return;
+    }
+    snprintf(line, sizeof(line), "-- Operation stats (%zu thread(s), %s kernels; time includes nested operations) --\n", threads, simd);
+    out << line;
+    snprintf(line, sizeof(line), "%-30s %8s %12s %12s %12s %12s %12s %12s\n",
+             "operation", "calls", "total ms", "mean us", "max us", "items", "allocs", "alloc KiB");
+    out << line;
+    for (int id = 0; id < STAT_COUNT; ++id) {
+        const OperationStats& stats = operationStats[id];
+        if (stats.calls == 0) continue;
+        snprintf(line, sizeof(line), "%-30s %8llu %12.3f %12.3f %12.3f %12llu %12llu %12.1f\n",
+                 STAT_NAMES[id], (unsigned long long)stats.calls, stats.totalNanos / 1e6,
+                 stats.totalNanos / 1e3 / stats.calls, stats.maxNanos / 1e3, (unsigned long long)stats.items,
+                 (unsigned long long)stats.allocations, stats.allocatedBytes / 1024.0);
+        out << line;
+    }
+    out << flush;
+}
+
+// Benchmarks include this file with CLIMASCOPE_NO_MAIN defined to reuse everything above
+#ifndef CLIMASCOPE_NO_MAIN
+// Function to print the --stats summary when the program exits
+void printStatsAtExit() {
+    consoleReport.flush();
+    writeStats(cerr, statsAsJson);
+}
+
+int main(int argc, char* argv[]) {
+    string snapshotPath, saveSnapshotPath, walPath, bindHost = "127.0.0.1";
+    bool dump = false, queryMode = false, bulletinMode = false, serveMode = false;
+    vector<string> queries, bulletins;
+    int port = 8080;
+    unsigned serveWorkers = 0;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "--data" && i + 1 < argc) {
+            dataFilePath = argv[++i];
+        } else if (arg == "--snapshot" && i + 1 < argc) {
+            snapshotPath = argv[++i];
+        } else if (arg == "--save-snapshot" && i + 1 < argc) {
+            saveSnapshotPath = argv[++i];
+        } else if (arg == "--wal" && i + 1 < argc) {
+            walPath = argv[++i];
+        } else if (arg == "--dump") {
+            dump = true;
+        } else if (arg == "--report-buffer" && i + 1 < argc) {
+            consoleReport.setThreshold(strtoull(argv[++i], nullptr, 10));
+        } else if (arg == "--result-cache" && i + 1 < argc) {
+            resultCache.setCapacity(strtoull(argv[++i], nullptr, 10));
+        } else if (arg == "--threads" && i + 1 < argc) {
+            workerThreads = static_cast<unsigned>(strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--simd" && i + 1 < argc) {
+            string level = argv[++i];
+            if (level == "scalar") {
+                simdLevel = SIMD_SCALAR;
+            } else if (level == "avx2" && detectSimdLevel() == SIMD_AVX2) {
+                simdLevel = SIMD_AVX2;
+            } else if (level != "auto") {
+                cout << "Error: SIMD level '" << level << "' is not supported on this machine." << endl;
+                return 1;
+            }
+        } else if (arg == "--stats") {
+            statsEnabled = countAllocations = true;
+            if (i + 1 < argc && (string(argv[i + 1]) == "table" || string(argv[i + 1]) == "json")) {
+                statsAsJson = string(argv[++i]) == "json";
+            }
+        } else if (arg == "query") {
+            queryMode = true;
+            for (++i; i < argc; ++i) {
+                if (string(argv[i]) != "-") queries.push_back(argv[i]);
+            }
+        } else if (arg == "bulletin") {
+            bulletinMode = true;
+            for (++i; i < argc; ++i) {
+                if (string(argv[i]) != "-") bulletins.push_back(argv[i]);
+            }
+        } else if (arg == "serve") {
+            serveMode = true;
+            for (++i; i + 1 < argc; i += 2) {
+                const string option = argv[i];
+                if (option == "--port") port = atoi(argv[i + 1]);
+                else if (option == "--bind") bindHost = argv[i + 1];
+                else if (option == "--workers") serveWorkers = static_cast<unsigned>(strtoul(argv[i + 1], nullptr, 10));
+                else break;
+            }
+            if (i < argc || port <= 0 || port > 65535) {
+                cout << "Usage: " << argv[0] << " [options] serve [--port <n>] [--bind <address>] [--workers <n>]" << endl;
+                return 1;
+            }
+        } else {
+            cout << "Usage: " << argv[0] << " [--data <typhoons.csv>] [--snapshot <file.snap>]"
+                 << " [--save-snapshot <file.snap>] [--wal <bulletins.log>] [--dump] [--report-buffer <bytes>]"
+                 << " [--result-cache <bytes>] [--threads <n>] [--simd auto|avx2|scalar] [--stats [table|json]]"
+                 << " [query [\"<query>\" ...] | bulletin [\"<bulletin>\" ...] | serve [--port <n>] [--bind <address>]"
+                 << " [--workers <n>]]" << endl;
+            return 1;
+        }
+    }
+
+    if (statsEnabled) atexit(printStatsAtExit);
+
+    if (bulletinMode) {
+        if (walPath.empty()) {
+            cout << "Error: bulletin needs --wal <file> to log to." << endl;
+            return 1;
+        }
+        if (bulletins.empty()) {
+            string line;
+            while (getline(cin, line)) {
+                if (!line.empty() && line.back() == '\r') line.pop_back();
+                if (!line.empty() && line[0] != '#') bulletins.push_back(line);
+            }
+        }
+        if (!writeBulletins(walPath, bulletins)) return 1;
+        cout << "Logged " << bulletins.size() << " bulletin(s) to " << walPath << endl;
+        return 0;
+    }
+
+    if (!saveSnapshotPath.empty()) {
+        vector<Typhoon> all;
+        StringArena text;
+        if (!loadTyphoonsFromFile(dataFilePath, 0, all, text)) return 1;
+        if (!saveSnapshot(saveSnapshotPath, all)) return 1;
+        cout << "Saved " << all.size() << " typhoon(s) to " << saveSnapshotPath << endl;
+        return 0;
+    }
+
+    // The snapshot holds the raw columns, not built tables: the modes that build every year's
+    // table would canonicalize every row either way, and parse the CSV faster than they rebuild
+    // records from the mapping. They read the CSV; the snapshot serves the menus.
+    if (!snapshotPath.empty() && (dump || queryMode || serveMode)) {
+        cerr << "Note: --snapshot only applies to the menus; reading " << dataFilePath << "." << endl;
+    }
+
+    if (dump) {
+        vector<Typhoon> all;
+        StringArena text;
+        if (!loadTyphoonsFromFile(dataFilePath, 0, all, text)) return 1;
+        TyphoonTable table = buildTable(move(all));
+        text.clear();
+        BulletinTarget target;
+        target.allYears = &table;
+        BulletinLog(walPath).poll(target);
+        ios::sync_with_stdio(false);
+        dumpArchive(table);
+        return 0;
+    }
+
+    if (queryMode || serveMode) {
+        vector<Typhoon> all;
+        StringArena text;
+        if (!loadTyphoonsFromFile(dataFilePath, 0, all, text)) return 1;
+        vector<TyphoonTable> built = buildYearTables(move(all));
+        text.clear(); // the tables keep their own copy of the text they display
+        // Bulletins may start tables for new years, so keep the tables where they cannot move
+        deque<TyphoonTable> years(make_move_iterator(built.begin()), make_move_iterator(built.end()));
+        BulletinTarget target;
+        target.newYears = &years;
+        for (TyphoonTable& table : years) target.years[table.year[0]] = &table;
+        BulletinLog bulletinLog(walPath);
+        bulletinLog.poll(target);
+        size_t unresolved = 0;
+        for (const TyphoonTable& table : years) unresolved += table.unresolvedPlaces;
+        if (unresolved > 0) {
+            cerr << "Note: " << unresolved << " place name(s) match no province or region; they are shown"
+                 << " but not searchable." << endl;
+        }
+        if (serveMode) {
+            // From here on the tables are shared, read-only, by the server's snapshots
+            map<int, shared_ptr<const TyphoonTable>> shared;
+            for (const auto& year : target.years) shared[year.first] = make_shared<TyphoonTable>(move(*year.second));
+            SnapshotStore store(move(shared));
+            return serveHttp(store, bulletinLog, bindHost, port, serveWorkers);
+        }
+        TyphoonDataset everything;
+        chainTables(everything, target);
+
+        ios::sync_with_stdio(false);
+        bool ok = true;
+        if (queries.empty()) {
+            string line;
+            while (getline(cin, line)) {
+                if (!line.empty() && line.back() == '\r') line.pop_back();
+                if (line.empty() || line[0] == '#') continue;
+                if (bulletinLog.poll(target)) chainTables(everything, target);
+                ok = runQuery(consoleReport, everything, line) && ok;
+            }
+        } else {
+            for (const string& query : queries) ok = runQuery(consoleReport, everything, query) && ok;
+        }
+        consoleReport.flush();
+        return ok ? 0 : 1;
+    }
+
+    MappedArchive archive;
+    if (!snapshotPath.empty() && !archive.open(snapshotPath)) return 1;
+
+    // The file text is only needed while a year's table is built
+    StringArena text;
+    TyphoonTable table2024 = buildTable(archive.isOpen() ? archive.loadYear(2024) : loadTyphoons(2024, text));
+    text.clear();
+    TyphoonTable table2025 = buildTable(archive.isOpen() ? archive.loadYear(2025) : loadTyphoons(2025, text));
+    text.clear();
+    BulletinTarget target;
+    target.years = {{2024, &table2024}, {2025, &table2025}};
+    BulletinLog bulletinLog(walPath);
+    bulletinLog.poll(target);
+    TyphoonDataset dataset;
+    chainTables(dataset, target);
+    // Bulletins picked up between menus; the mapped archive does not see them
+    auto applyNewBulletins = [&] {
+        if (bulletinLog.poll(target)) chainTables(dataset, target);
+    };
+    const bool mappedSearches = archive.isOpen() && !bulletinLog.isOpen();
+
+    int choice;
+    bool running = true;
+
+    while (running) {
+        applyNewBulletins();
+        cout << "\nWelcome to ClimaScope\n" << endl << endl;
+        cout << " Homepage " << endl;
+        cout << "1. Swipe Up" << endl;
+        cout << "2. Search" << endl;
+        cout << "3. Menu" << endl;
+        cout << "4. Exit the Execution" << endl;
+        cout << "Enter your choice: ";
+        cin >> choice;
+        if (cin.fail()) {
+            cin.clear();
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+            cout << "Invalid input. Please enter a number." << endl;
+            continue;
+        }
+
+        switch (choice) {
+            case 1: { // Swipe Up -> Year
+                bool inYear = true;
+                while (inYear) {
+                    applyNewBulletins();
+                    cout << "----------------------------------------" << endl;
+                    cout << "– Year –" << endl;
+                    cout << "1. 2024" << endl;
+                    cout << "2. 2025" << endl;
+                    cout << "3. Menu" << endl;
+                    cout << "4. Back" << endl;
+                    cout << "Enter your choice: ";
+                    cin >> choice;
+                    if (cin.fail()) {
+                        cin.clear();
+                        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                        cout << "Invalid input. Please enter a number." << endl;
+                        continue;
+                    }
+                    switch (choice) {
+                        case 1: { // 2024
+                            bool inMonths2024 = true;
+                            while (inMonths2024) {
+                                applyNewBulletins();
+                                cout << "----------------------------------------" << endl;
+                                cout << "– Months that has typhoon(s) for 2024 –" << endl;
+                                cout << "1. May" << endl;
+                                cout << "2. July" << endl;
+                                cout << "3. August" << endl;
+                                cout << "4. September" << endl;
+                                cout << "5. October" << endl;
+                                cout << "6. November" << endl;
+                                cout << "7. December" << endl;
+                                cout << "8. Back" << endl;
+                                cout << "9. Menu" << endl;
+                                cout << "Enter your choice: ";
+                                cin >> choice;
+                                if (cin.fail()) {
+                                    cin.clear();
+                                    cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                    cout << "Invalid input. Please enter a number." << endl;
+                                    continue;
+                                }
+                                if (choice >= 1 && choice <= 7) {
+                                    int month = (choice == 1) ? 5 :
+                                                (choice == 2) ? 7 :
+                                                (choice == 3) ? 8 :
+                                                (choice == 4) ? 9 :
+                                                (choice == 5) ? 10 :
+                                                (choice == 6) ? 11 : 12;
+
+                                    cout << "----------------------------------------" << endl;
+                                    cout << "– Typhoon(s) for the month of "
+                                         << ((choice == 1) ? "May" :
+                                             (choice == 2) ? "July" :
+                                             (choice == 3) ? "August" :
+                                             (choice == 4) ? "September" :
+                                             (choice == 5) ? "October" :
+                                             (choice == 6) ? "November" : "December")
+                                         << " 2024 –" << endl;
+                                    displayMonth(table2024, 2024, month);
+                                    cout << "1. Resolution(s) / Recommendation(s) for 2024" << endl;
+                                    cout << "2. Menu" << endl;
+                                    cout << "3. Back" << endl;
+                                    cout << "Enter your choice: ";
+                                    cin >> choice;
+                                    if (cin.fail()) {
+                                        cin.clear();
+                                        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                        cout << "Invalid input. Please enter a number." << endl;
+                                        continue;
+                                    }
+                                    switch (choice) {
+                                        case 1:
+                                            displayResolutions(2024);
+                                            cout << "1. Menu" << endl;
+                                            cout << "2. Back" << endl;
+                                            cin >> choice;
+                                            if (cin.fail()) {
+                                                cin.clear();
+                                                cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                                continue;
+                                            }
+                                            if (choice == 1) inMonths2024 = false;
+                                            break;
+                                        case 2:
+                                            inMonths2024 = false;
+                                            break;
+                                        case 3:
+                                            break; // Back to months
+                                        default:
+                                            cout << "Invalid choice." << endl;
+                                    }
+                                } else if (choice == 8) {
+                                    inMonths2024 = false;
+                                } else if (choice == 9) {
+                                    inMonths2024 = false;
+                                    inYear = false;
+                                } else {
+                                    cout << "Invalid choice." << endl;
+                                }
+                            }
+                            break;
+                        }
+                        case 2: { // 2025
+                            bool inMonths2025 = true;
+                            while (inMonths2025) {
+                                applyNewBulletins();
+                                cout << "----------------------------------------" << endl;
+                                cout << "– Months that has typhoon(s) for 2025 –" << endl;
+                                cout << "1. July" << endl;
+                                cout << "2. August" << endl;
+                                cout << "3. September" << endl;
+                                cout << "4. October" << endl;
+                                cout << "5. November" << endl;
+                                cout << "6. December" << endl;
+                                cout << "7. Back" << endl;
+                                cout << "8. Menu" << endl;
+                                cout << "Enter your choice: ";
+                                cin >> choice;
+                                if (cin.fail()) {
+                                    cin.clear();
+                                    cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                    cout << "Invalid input. Please enter a number." << endl;
+                                    continue;
+                                }
+                                if (choice >= 1 && choice <= 6) {
+                                    int month = (choice == 1) ? 7 :
+                                                (choice == 2) ? 8 :
+                                                (choice == 3) ? 9 :
+                                                (choice == 4) ? 10 :
+                                                (choice == 5) ? 11 : 12;
+
+                                    cout << "----------------------------------------" << endl;
+                                    cout << "– Typhoon(s) for the month of "
+                                         << ((choice == 1) ? "July" :
+                                             (choice == 2) ? "August" :
+                                             (choice == 3) ? "September" :
+                                             (choice == 4) ? "October" :
+                                             (choice == 5) ? "November" : "December")
+                                         << " 2025 –" << endl;
+                                    displayMonth(table2025, 2025, month);
+                                    cout << "1. Resolution(s) / Recommendation(s) for 2025" << endl;
+                                    cout << "2. Menu" << endl;
+                                    cout << "3. Back" << endl;
+                                    cout << "Enter your choice: ";
+                                    cin >> choice;
+                                    if (cin.fail()) {
+                                        cin.clear();
+                                        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                        cout << "Invalid input. Please enter a number." << endl;
+                                        continue;
+                                    }
+                                    switch (choice) {
+                                        case 1:
+                                            displayResolutions(2025);
+                                            cout << "1. Menu" << endl;
+                                            cout << "2. Back" << endl;
+                                            cin >> choice;
+                                            if (cin.fail()) {
+                                                cin.clear();
+                                                cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                                continue;
+                                            }
+                                            if (choice == 1) inMonths2025 = false;
+                                            break;
+                                        case 2:
+                                            inMonths2025 = false;
+                                            break;
+                                        case 3:
+                                            break; // Back to months
+                                        default:
+                                            cout << "Invalid choice." << endl;
+                                    }
+                                } else if (choice == 7) {
+                                    inMonths2025 = false;
+                                } else if (choice == 8) {
+                                    inMonths2025 = false;
+                                    inYear = false;
+                                } else {
+                                    cout << "Invalid choice." << endl;
+                                }
+                            }
+                            break;
+                        }
+                        case 3: // Menu
+                            inYear = false;
+                            break;
+                        case 4: // Back
+                            inYear = false;
+                            break;
+                        default:
+                            cout << "Invalid choice." << endl;
+                    }
+                }
+                break;
+            }
+            case 2: { // Search
+                bool inSearch = true;
+                while (inSearch) {
+                    applyNewBulletins();
+                    cout << "----------------------------------------" << endl;
+                    cout << "– Searching –" << endl;
+                    cout << "1. Top 3 Strongest Typhoons from 2024 - 2025 (Based on their Wind Speed)" << endl;
+                    cout << "2. Most Damaging Typhoon (Based on the cost in Peso)" << endl;
+                    cout << "3. List all names of Typhoons from 2024 - 2025 by Alphabetical Order (A-Z)" << endl;
+                    cout << "4. Longest Stay in Land (Arrival to Departure)" << endl;
+                    cout << "5. Sort all typhoons that made Landfall (Based on Storm Crossing)" << endl;
+                    cout << "6. Typhoons that hit a Province or Region" << endl;
+                    cout << "7. Provinces / Regions hit in more than N months" << endl;
+                    cout << "8. Top K Typhoons by Wind, Casualties, Damages or Stay Duration" << endl;
+                    cout << "9. Find a Typhoon by Name" << endl;
+                    cout << "Enter your choice: ";
+                    cin >> choice;
+                    if (cin.fail()) {
+                        cin.clear();
+                        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                        cout << "Invalid input. Please enter a number." << endl;
+                        continue;
+                    }
+                    switch (choice) {
+                        case 1:
+                            if (mappedSearches) searchTop3Strongest(archive);
+                            else searchTop3Strongest(dataset);
+                            break;
+                        case 2:
+                            if (mappedSearches) searchMostDamaging(archive);
+                            else searchMostDamaging(dataset);
+                            break;
+                        case 3:
+                            searchAlphabetical(dataset);
+                            break;
+                        case 4:
+                            searchLongestStay(dataset);
+                            break;
+                        case 5:
+                            searchLandfall(dataset);
+                            break;
+                        case 6:
+                            searchByPlace(dataset);
+                            break;
+                        case 7:
+                            searchPlacesHitInMonths(dataset);
+                            break;
+                        case 8:
+                            searchTopK(dataset);
+                            break;
+                        case 9:
+                            searchByName(dataset);
+                            break;
+                        default:
+                            cout << "Invalid choice." << endl;
+                    }
+                    cout << "1. Menu" << endl;
+                    cout << "2. Back" << endl;
+                    cout << "Enter your choice: ";
+                    cin >> choice;
+                    if (cin.fail()) {
+                        cin.clear();
+                        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                        cout << "Invalid input. Please enter a number." << endl;
+                        continue;
+                    }
+                    if (choice == 1) inSearch = false;
+                    // If 2, stay in search
+                }
+                break;
+            }
+            case 3: { // Menu
+                bool inMenu = true;
+                while (inMenu) {
+                    cout << "----------------------------------------" << endl;
+                    cout << "– Menu –" << endl;
+                    cout << "1. Home" << endl;
+                    cout << "2. Contact" << endl;
+                    cout << "3. Setting" << endl;
+                    cout << "4. About" << endl;
+                    cout << "Enter your choice: ";
+                    cin >> choice;
+                    if (cin.fail()) {
+                        cin.clear();
+                        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                        cout << "Invalid input. Please enter a number." << endl;
+                        continue;
+                    }
+                    switch (choice) {
+                        case 1: // Home
+                            inMenu = false;
+                            break;
+                        case 2: { // Contact
+                            bool inContact = true;
+                            while (inContact) {
+                                cout << "----------------------------------------" << endl;
+                                cout << "– Contact Us –" << endl;
+                                cout << "1. Location" << endl;
+                                cout << "2. Email" << endl;
+                                cout << "3. Tel No." << endl;
+                                cout << "– Follow Us –" << endl;
+                                cout << "4. Facebook" << endl;
+                                cout << "5. X (Twitter)" << endl;
+                                cout << "6. Instagram" << endl;
+                                cout << "Enter your choice: ";
+                                cin >> choice;
+                                if (cin.fail()) {
+                                    cin.clear();
+                                    cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                    cout << "Invalid input. Please enter a number." << endl;
+                                    continue;
+                                }
+                                switch (choice) {
+                                    case 1:
+                                        cout << "----------------------------------------" << endl;
+                                        cout << "– Location –" << endl;
+                                        cout << "629 J. Nepomuceno Street, Quiapo, Manila, Philippines 1001" << endl;
+                                        cout << "1. Menu" << endl;
+                                        cout << "2. Back" << endl;
+                                        cin >> choice;
+                                        if (cin.fail()) {
+                                            cin.clear();
+                                            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                            continue;
+                                        }
+                                        if (choice == 1) inContact = false;
+                                        break;
+                                    case 2:
+                                        cout << "----------------------------------------" << endl;
+                                        cout << "– Email –" << endl;
+                                        cout << "info@climascopo.ph" << endl;
+                                        cout << "1. Menu" << endl;
+                                        cout << "2. Back" << endl;
+                                        cin >> choice;
+                                        if (cin.fail()) {
+                                            cin.clear();
+                                            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                            continue;
+                                        }
+                                        if (choice == 1) inContact = false;
+                                        break;
+                                    case 3:
+                                        cout << "----------------------------------------" << endl;
+                                        cout << "– Tel No. –" << endl;
+                                        cout << "+63 2 123 4567" << endl;
+                                        cout << "1. Menu" << endl;
+                                        cout << "2. Back" << endl;
+                                        cin >> choice;
+                                        if (cin.fail()) {
+                                            cin.clear();
+                                            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                            continue;
+                                        }
+                                        if (choice == 1) inContact = false;
+                                        break;
+                                    case 4:
+                                        cout << "----------------------------------------" << endl;
+                                        cout << "– Facebook –" << endl;
+                                        cout << "Link: www.Facebook.com/clima-scope/jfdihiefuh483nUT7GAYUYgubed/source=?/k" << endl;
+                                        cout << "1. Menu" << endl;
+                                        cout << "2. Back" << endl;
+                                        cin >> choice;
+                                        if (cin.fail()) {
+                                            cin.clear();
+                                            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                            continue;
+                                        }
+                                        if (choice == 1) inContact = false;
+                                        break;
+                                    case 5:
+                                        cout << "----------------------------------------" << endl;
+                                        cout << "– X (Twitter) –" << endl;
+                                        cout << "Link: www.twitter.com/climascopo" << endl;
+                                        cout << "1. Menu" << endl;
+                                        cout << "2. Back" << endl;
+                                        cin >> choice;
+                                        if (cin.fail()) {
+                                            cin.clear();
+                                            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                            continue;
+                                        }
+                                        if (choice == 1) inContact = false;
+                                        break;
+                                    case 6:
+                                        cout << "----------------------------------------" << endl;
+                                        cout << "– Instagram –" << endl;
+                                        cout << "Link: www.instagram.com/climascopo" << endl;
+                                        cout << "1. Menu" << endl;
+                                        cout << "2. Back" << endl;
+                                        cin >> choice;
+                                        if (cin.fail()) {
+                                            cin.clear();
+                                            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                            continue;
+                                        }
+                                        if (choice == 1) inContact = false;
+                                        break;
+                                    default:
+                                        cout << "Invalid choice." << endl;
+                                }
+                            }
+                            break;
+                        }
+                        case 3: { // Setting
+                            bool inSetting = true;
+                            while (inSetting) {
+                                cout << "----------------------------------------" << endl;
+                                cout << "– Settings –" << endl;
+                                cout << "1. Preference" << endl;
+                                cout << "2. Notifications" << endl;
+                                cout << "3. Legal & Policies" << endl;
+                                cout << "4. Help" << endl;
+                                cout << "5. Report Technical Problem" << endl;
+                                cout << "6. Rate Us" << endl;
+                                cout << "7. Menu" << endl;
+                                cout << "Enter your Choice: ";
+                                cin >> choice;
+                                if (cin.fail()) {
+                                    cin.clear();
+                                    cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                    cout << "Invalid input. Please enter a number." << endl;
+                                    continue;
+                                }
+                                switch (choice) {
+                                    case 1: { // Preference
+                                        bool inPreference = true;
+                                        while (inPreference) {
+                                            cout << "----------------------------------------" << endl;
+                                            cout << "– Preference –" << endl;
+                                            cout << "1. Dark Mode" << endl;
+                                            cout << "2. Default" << endl;
+                                            cout << "3. Menu" << endl;
+                                            cout << "4. Back" << endl;
+                                            cout << "Enter your choice: ";
+                                            cin >> choice;
+                                            if (cin.fail()) {
+                                                cin.clear();
+                                                cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                                cout << "Invalid input. Please enter a number." << endl;
+                                                continue;
+                                            }
+                                            switch (choice) {
+                                                case 1:
+                                                    cout << "----------------------------------------" << endl;
+                                                    cout << "– Dark Mode has been applied –" << endl;
+                                                    cout << "1. Menu" << endl;
+                                                    cout << "2. Back" << endl;
+                                                    cin >> choice;
+                                                    if (cin.fail()) {
+                                                        cin.clear();
+                                                        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                                        continue;
+                                                    }
+                                                    if (choice == 1) inPreference = false;
+                                                    break;
+                                                case 2:
+                                                    cout << "----------------------------------------" << endl;
+                                                    cout << "– Default Mode has been applied –" << endl;
+                                                    cout << "1. Menu" << endl;
+                                                    cout << "2. Back" << endl;
+                                                    cin >> choice;
+                                                    if (cin.fail()) {
+                                                        cin.clear();
+                                                        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                                        continue;
+                                                    }
+                                                    if (choice == 1) inPreference = false;
+                                                    break;
+                                                case 3:
+                                                    inPreference = false;
+                                                    break;
+                                                case 4:
+                                                    inPreference = false;
+                                                    break;
+                                                default:
+                                                    cout << "Invalid choice." << endl;
+                                            }
+                                        }
+                                        break;
+                                    }
+                                    case 2:
+                                        cout << "----------------------------------------" << endl;
+                                        cout << "– Notifications –" << endl;
+                                        cout << "Notifications settings here." << endl;
+                                        cout << "1. Menu" << endl;
+                                        cout << "2. Back" << endl;
+                                        cin >> choice;
+                                        if (cin.fail()) {
+                                            cin.clear();
+                                            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                            continue;
+                                        }
+                                        if (choice == 1) inSetting = false;
+                                        break;
+                                    case 3:
+                                        cout << "----------------------------------------" << endl;
+                                        cout << "– Legal & Policies –" << endl;
+                                        cout << "Privacy Policy and Terms of Service text here." << endl;
+                                        cout << "1. Menu" << endl;
+                                        cout << "2. Back" << endl;
+                                        cin >> choice;
+                                        if (cin.fail()) {
+                                            cin.clear();
+                                            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                            continue;
+                                        }
+                                        if (choice == 1) inSetting = false;
+                                        break;
+                                    case 4:
+                                        cout << "----------------------------------------" << endl;
+                                        cout << "– Help –" << endl;
+                                        cout << "Help information here." << endl;
+                                        cout << "1. Menu" << endl;
+                                        cout << "2. Back" << endl;
+                                        cin >> choice;
+                                        if (cin.fail()) {
+                                            cin.clear();
+                                            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                            continue;
+                                        }
+                                        if (choice == 1) inSetting = false;
+                                        break;
+                                    case 5:
+                                        cout << "----------------------------------------" << endl;
+                                        cout << "– Report Technical Problem –" << endl;
+                                        cout << "Report form here." << endl;
+                                        cout << "1. Menu" << endl;
+                                        cout << "2. Back" << endl;
+                                        cin >> choice;
+                                        if (cin.fail()) {
+                                            cin.clear();
+                                            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                            continue;
+                                        }
+                                        if (choice == 1) inSetting = false;
+                                        break;
+                                    case 6:
+                                        cout << "----------------------------------------" << endl;
+                                        cout << "– Rate Us –" << endl;
+                                        cout << "Rating system here." << endl;
+                                        cout << "1. Menu" << endl;
+                                        cout << "2. Back" << endl;
+                                        cin >> choice;
+                                        if (cin.fail()) {
+                                            cin.clear();
+                                            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                            continue;
+                                        }
+                                        if (choice == 1) inSetting = false;
+                                        break;
+                                    case 7:
+                                        inSetting = false;
+                                        break;
+                                    default:
+                                        cout << "Invalid choice." << endl;
+                                }
+                            }
+                            break;
+                        }
+                        case 4: { // About
+                            cout << "----------------------------------------" << endl;
+                            cout << "– About –" << endl;
+                            cout << "\"ClimaScope: Tracking, Impact, and Climate Solutions for Philippine Typhoons.\"" << endl;
+                            cout << "\"ClimaScope is a comprehensive platform that tracks typhoons in the Philippines, analyzes their impact, and provides climate-smart solutions to support preparedness and resilience.\"" << endl;
+                            cout << "– Privacy policy –" << endl;
+                            cout << "– Terms of Service –" << endl;
+                            cout << "1. Back" << endl;
+                            cout << "2. Menu" << endl;
+                            cin >> choice;
+                            if (cin.fail()) {
+                                cin.clear();
+                                cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                cout << "Invalid input. Please enter a number." << endl;
+                                continue;
+                            }
+                            if (choice == 2) inMenu = false;
+                            break;
+                        }
+                        default:
+                            cout << "Invalid choice." << endl;
+                    }
+                }
+                break;
+            }
+            case 4: // Exit
+                running = false;
+                break;
+            default:
+                cout << "Invalid choice." << endl;
+        }
+    }
+    return 0;
+}
+#endif
@@ -0,0 +1,80 @@
+// Command-line generator for synthetic typhoon archives in the typhoons.csv layout, for load
+// testing the loader, indexes and queries at any scale. See tools/synthetic_archive.h for how
+// storms are derived from the reference archive.
+//
+//   generate_archive --rows 1000000 [--seed 2024] [--years 1951-2025]
+//                    [--reference typhoons.csv] [--out archive.csv] [--snapshot archive.snap]
+#define CLIMASCOPE_NO_MAIN
+#include "../climatechange.cpp"
+#include "../tools/synthetic_archive.h"
+
+#ifndef CLIMASCOPE_REFERENCE_ARCHIVE
+#define CLIMASCOPE_REFERENCE_ARCHIVE "typhoons.csv"
+#endif
+
+int main(int argc, char* argv[]) {
+    SyntheticArchiveOptions options;
+    string referencePath = CLIMASCOPE_REFERENCE_ARCHIVE, outPath, snapshotOut;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "--rows" && i + 1 < argc) {
+            options.rows = strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--seed" && i + 1 < argc) {
+            options.seed = strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--years" && i + 1 < argc
+                   && sscanf(argv[++i], "%d-%d", &options.firstYear, &options.lastYear) == 2
+                   && options.firstYear <= options.lastYear) {
+            // parsed above
+        } else if (arg == "--reference" && i + 1 < argc) {
+            referencePath = argv[++i];
+        } else if (arg == "--out" && i + 1 < argc) {
+            outPath = argv[++i];
+        } else if (arg == "--snapshot" && i + 1 < argc) {
+            snapshotOut = argv[++i];
+        } else {
+            cout << "Usage: " << argv[0] << " --rows <n> [--seed <n>] [--years <first>-<last>]"
+                 << " [--reference <typhoons.csv>] [--out <archive.csv>] [--snapshot <archive.snap>]" << endl;
+            return 1;
+        }
+    }
+    if (outPath.empty() && snapshotOut.empty()) outPath = "synthetic_typhoons.csv";
+
+    SyntheticProfile profile;
+    if (!loadSyntheticProfile(referencePath, profile)) return 1;
+
+    // The CSV is streamed row by row (reusing one arena block) so archives larger than memory can
+    // be written; a snapshot needs every record at once
+    ofstream csv;
+    if (!outPath.empty()) {
+        csv.open(outPath, ios::binary);
+        if (!csv) {
+            cout << "Error: Cannot write archive '" << outPath << "'." << endl;
+            return 1;
+        }
+        writeArchiveHeader(csv);
+    }
+    vector<Typhoon> kept;
+    StringArena text;
+    if (!snapshotOut.empty()) kept.reserve(options.rows);
+    generateSyntheticArchive(options, profile, text, [&](Typhoon&& t) {
+        if (csv.is_open()) writeArchiveRow(csv, t);
+        if (!snapshotOut.empty()) {
+            kept.push_back(move(t));
+        } else {
+            text.clear();
+        }
+    });
+    if (csv.is_open()) {
+        csv.close();
+        if (!csv) {
+            cout << "Error: Writing '" << outPath << "' failed." << endl;
+            return 1;
+        }
+        cout << "Wrote " << options.rows << " synthetic typhoon(s) to " << outPath << endl;
+    }
+    if (!snapshotOut.empty()) {
+        if (!saveSnapshot(snapshotOut, kept)) return 1;
+        cout << "Wrote " << kept.size() << " synthetic typhoon(s) to " << snapshotOut << endl;
+    }
+    return 0;
+}
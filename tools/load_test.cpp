@@ -0,0 +1,126 @@
+// Load-test client for `climascope serve`. Keeps a number of keep-alive connections busy, each
+// sending one GET request at a time and cycling through the given paths (default: a mix of the
+// month, ranking, place and resolutions endpoints), then reports throughput and latency
+// percentiles over all requests.
+//
+//   load_test [--host 127.0.0.1] [--port 8080] [--connections 8] [--requests 20000]
+//             [--path "/top?by=wind&k=10"] ...
+#define CLIMASCOPE_NO_MAIN
+#include "../climatechange.cpp"
+
+const int RESPONSE_TIMEOUT_MS = 10000;
+
+// Function to read one response from a connection; pending keeps bytes of the next response.
+// Returns the status, or 0 when the connection failed or timed out.
+int readResponse(SocketHandle s, string& pending, bool& keepAlive) {
+    size_t headEnd;
+    while ((headEnd = pending.find("\r\n\r\n")) == string::npos) {
+        if (receiveSome(s, pending, RESPONSE_TIMEOUT_MS) <= 0) return 0;
+    }
+    const string head = normalizedLower(string_view(pending).substr(0, headEnd));
+    int status = 0;
+    if (sscanf(head.c_str(), "http/%*d.%*d %d", &status) != 1) return 0;
+    const size_t lengthAt = head.find("content-length:");
+    if (lengthAt == string::npos) return 0;
+    const size_t length = strtoull(head.c_str() + lengthAt + 15, nullptr, 10);
+    keepAlive = head.find("connection: close") == string::npos;
+    while (pending.size() < headEnd + 4 + length) {
+        if (receiveSome(s, pending, RESPONSE_TIMEOUT_MS) <= 0) return 0;
+    }
+    pending.erase(0, headEnd + 4 + length);
+    return status;
+}
+
+// Function to get the latency below which the given fraction of requests finished
+double percentile(const vector<double>& sorted, double fraction) {
+    if (sorted.empty()) return 0;
+    const size_t rank = static_cast<size_t>(ceil(fraction * sorted.size()));
+    return sorted[min(sorted.size(), max<size_t>(rank, 1)) - 1];
+}
+
+int main(int argc, char* argv[]) {
+    string host = "127.0.0.1";
+    int port = 8080;
+    size_t connections = 8, requests = 20000;
+    vector<string> paths;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "--host" && i + 1 < argc) {
+            host = argv[++i];
+        } else if (arg == "--port" && i + 1 < argc) {
+            port = atoi(argv[++i]);
+        } else if (arg == "--connections" && i + 1 < argc) {
+            connections = max<size_t>(1, strtoull(argv[++i], nullptr, 10));
+        } else if (arg == "--requests" && i + 1 < argc) {
+            requests = strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--path" && i + 1 < argc) {
+            paths.push_back(argv[++i]);
+        } else {
+            cout << "Usage: " << argv[0] << " [--host <address>] [--port <n>] [--connections <n>]"
+                 << " [--requests <n>] [--path <path> ...]" << endl;
+            return 1;
+        }
+    }
+    if (paths.empty()) {
+        paths = {"/month?month=9&year=2024", "/top?by=wind&k=10", "/top?by=damages&k=3",
+                 "/place?name=Albay", "/resolutions?year=2025"};
+    }
+    if (!startSockets()) return 1;
+    SocketHandle probe = openSocket(host, port, false);
+    if (probe == NO_SOCKET) {
+        cout << "Error: Cannot connect to " << host << ":" << port << "." << endl;
+        return 1;
+    }
+    closeSocket(probe);
+
+    vector<vector<double>> latencies(connections);
+    atomic<size_t> failed{0}, notOk{0};
+    auto client = [&](size_t c) {
+        const size_t count = requests / connections + (c < requests % connections ? 1 : 0);
+        latencies[c].reserve(count);
+        SocketHandle s = NO_SOCKET;
+        string pending;
+        for (size_t r = 0; r < count; ++r) {
+            if (s == NO_SOCKET) {
+                s = openSocket(host, port, false);
+                pending.clear();
+                if (s == NO_SOCKET) {
+                    ++failed;
+                    continue;
+                }
+            }
+            const string request = "GET " + paths[(c + r * connections) % paths.size()] + " HTTP/1.1\r\nHost: " + host + "\r\n\r\n";
+            const auto start = chrono::steady_clock::now();
+            bool keepAlive = true;
+            const int status = sendAll(s, request) ? readResponse(s, pending, keepAlive) : 0;
+            latencies[c].push_back(chrono::duration<double, micro>(chrono::steady_clock::now() - start).count());
+            if (status == 0) ++failed;
+            else if (status != 200) ++notOk;
+            if (status == 0 || !keepAlive) {
+                closeSocket(s);
+                s = NO_SOCKET;
+            }
+        }
+        if (s != NO_SOCKET) closeSocket(s);
+    };
+
+    const auto start = chrono::steady_clock::now();
+    vector<thread> pool;
+    for (size_t c = 0; c < connections; ++c) pool.emplace_back(client, c);
+    for (thread& t : pool) t.join();
+    const double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    vector<double> all;
+    for (const auto& l : latencies) all.insert(all.end(), l.begin(), l.end());
+    sort(all.begin(), all.end());
+    char line[160];
+    snprintf(line, sizeof(line), "Requests:     %zu over %zu connection(s), %zu failed, %zu not 200\n",
+             all.size(), connections, failed.load(), notOk.load());
+    cout << line;
+    snprintf(line, sizeof(line), "Elapsed:      %.3f s (%.1f requests/s)\n", seconds, seconds > 0 ? all.size() / seconds : 0.0);
+    cout << line;
+    snprintf(line, sizeof(line), "Latency (us): p50 %.1f  p90 %.1f  p99 %.1f  max %.1f\n", percentile(all, 0.50),
+             percentile(all, 0.90), percentile(all, 0.99), all.empty() ? 0.0 : all.back());
+    cout << line;
+    return failed || notOk ? 1 : 0;
+}
@@ -0,0 +1,209 @@
+// Synthetic typhoon archives for benchmarks and scale tests.
+//
+// Include after climatechange.cpp (with CLIMASCOPE_NO_MAIN defined): the generator reuses its
+// Typhoon record, the date helpers and the place canonicalization. Archives are a smoothed
+// bootstrap of a reference archive (normally typhoons.csv): every synthetic storm starts from a
+// randomly drawn real storm, keeping its month, level, path and crossing together, and jitters
+// its wind, damages, casualties, stay and affected provinces. That keeps the seasonality and the
+// level/wind/damage correlations of the real data. Output is fully determined by the seed and
+// the reference archive.
+#ifndef CLIMASCOPE_SYNTHETIC_ARCHIVE_H
+#define CLIMASCOPE_SYNTHETIC_ARCHIVE_H
+
+#include <random>
+
+struct SyntheticArchiveOptions {
+    size_t rows = 1000;
+    uint64_t seed = 2024;
+    int firstYear = 1951;
+    int lastYear = 2025;
+};
+
+// Real storms the generator draws from, with their places already canonicalized
+struct SyntheticProfile {
+    StringArena text;                     // the reference archive the templates view
+    vector<Typhoon> templates;
+    vector<int32_t> stayMinutes;          // per template; -1 if unknown
+    vector<vector<string>> placeSets;     // per template, canonical names
+    map<string, vector<string>> siblings; // seeded place -> places of the same region
+};
+
+// Function to prepare a profile from reference records (their text must stay alive, normally in
+// profile.text); false if there are none
+bool fitSyntheticProfile(vector<Typhoon>&& reference, SyntheticProfile& profile) {
+    if (reference.empty()) return false;
+    profile.templates = move(reference);
+    for (const Typhoon& t : profile.templates) {
+        const bool timed = t.arrivalTime != NO_TIMESTAMP && t.departureTime != NO_TIMESTAMP
+                           && t.departureTime >= t.arrivalTime;
+        profile.stayMinutes.push_back(timed ? t.departureTime - t.arrivalTime : -1);
+        vector<string> places, tokenPlaces;
+        forEachPlaceToken(t.placesAffected, [&](string_view token) {
+            canonicalPlaces(token, tokenPlaces);
+            for (const string& place : tokenPlaces) {
+                if (find(places.begin(), places.end(), place) == places.end()) places.push_back(place);
+            }
+        });
+        profile.placeSets.push_back(move(places));
+    }
+    map<int, vector<string>> regions;
+    for (const char* place : PLACE_SEED) regions[regionOfPlace(place)].push_back(place);
+    for (const auto& region : regions) {
+        for (const string& place : region.second) profile.siblings[place] = region.second;
+    }
+    return true;
+}
+
+// Function to load a reference archive and prepare the profile; false if it has no records
+bool loadSyntheticProfile(const string& referencePath, SyntheticProfile& profile) {
+    vector<Typhoon> reference;
+    if (!loadTyphoonsFromFile(referencePath, 0, reference, profile.text)) return false;
+    if (!fitSyntheticProfile(move(reference), profile)) {
+        cout << "Error: Reference archive '" << referencePath << "' has no records." << endl;
+        return false;
+    }
+    return true;
+}
+
+// Function to format minutes since epoch as the archive's "HHMM_MM/DD"
+string syntheticStamp(int32_t minutes) {
+    const int32_t days = minutes >= 0 ? minutes / 1440 : (minutes - 1439) / 1440; // floor, for pre-1970 years
+    const int clock = minutes - days * 1440;
+    int year, month, day;
+    civilFromDays(days, year, month, day);
+    char text[48]; // room for any four ints, not just the 11 bytes of "HHMM_MM/DD"
+    snprintf(text, sizeof(text), "%02d%02d_%02d/%02d", clock / 60, clock % 60, month, day);
+    return text;
+}
+
+// Function to make one synthetic storm, keeping its new text in text; serial keeps generated
+// names unique
+Typhoon makeSyntheticTyphoon(mt19937_64& rng, const SyntheticArchiveOptions& options,
+                             const SyntheticProfile& profile, size_t serial, StringArena& text) {
+    static const int monthDays[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    static const char* const monthNames[] = {"January", "February", "March", "April", "May", "June", "July",
+                                             "August", "September", "October", "November", "December"};
+    uniform_real_distribution<double> unit(0.0, 1.0);
+    lognormal_distribution<double> spread(0.0, 0.5);
+    auto pick = [&](size_t n) { return static_cast<size_t>(rng() % n); };
+
+    const size_t source = pick(profile.templates.size());
+    const Typhoon& real = profile.templates[source];
+    Typhoon t;
+    t.year = options.firstYear + static_cast<int>(pick(options.lastYear - options.firstYear + 1));
+    t.name = text.store(string(real.name) + " " + to_string(serial));
+
+    // Same month as the real storm, any day and hour; the stay is the real one +/- 25%
+    int month = getMonthInt(real.month);
+    if (month == 0) month = timestampMonth(real.arrivalTime);
+    if (month == 0) month = 1 + static_cast<int>(pick(12));
+    t.month = monthNames[month - 1];
+    const int32_t arrival = daysFromCivil(t.year, month, 1 + static_cast<int>(pick(monthDays[month - 1]))) * 1440
+                            + static_cast<int32_t>(pick(24)) * 60;
+    const int32_t realStay = profile.stayMinutes[source] >= 0 ? profile.stayMinutes[source] : 72 * 60;
+    const int32_t stay = max<int32_t>(60, static_cast<int32_t>(realStay * (0.75 + 0.5 * unit(rng))) / 60 * 60);
+    t.arrival = text.store(syntheticStamp(arrival));
+    t.departure = text.store(syntheticStamp(arrival + stay));
+    t.interval = text.store(to_string((stay + 12 * 60) / (24 * 60)));
+
+    t.stormCrossing = real.stormCrossing;
+    t.timeOfLandfall = canonicalCrossing(real.stormCrossing) == "Land"
+                       ? text.store(syntheticStamp(arrival + static_cast<int32_t>(stay * unit(rng)) / 60 * 60))
+                       : string_view();
+    t.developed = real.developed;
+    t.pathType = real.pathType;
+    t.levels = real.levels;
+
+    // Wind within 10% of the real storm (in 5 km/h steps); losses scaled by a log-normal factor
+    t.windSpeed = max(25, static_cast<int>(real.windSpeed * (0.9 + 0.2 * unit(rng)) / 5.0 + 0.5) * 5);
+    t.casualties = real.casualties == 0 && unit(rng) < 0.8
+                   ? 0 : static_cast<int>(max(0.0, (real.casualties + 1) * spread(rng) - 1.0) + 0.5);
+    t.damages = real.damages == 0.0 && unit(rng) < 0.8
+                ? 0.0 : round(max(real.damages, 1.0e6) * spread(rng) * 100.0) / 100.0;
+
+    // The real place set, sometimes losing one place and sometimes gaining a neighbour
+    vector<string> places = profile.placeSets[source];
+    if (places.size() > 1 && unit(rng) < 0.25) places.erase(places.begin() + pick(places.size()));
+    if (!places.empty() && unit(rng) < 0.25) {
+        auto region = profile.siblings.find(places[pick(places.size())]);
+        if (region != profile.siblings.end()) {
+            const string& added = region->second[pick(region->second.size())];
+            if (find(places.begin(), places.end(), added) == places.end()) places.push_back(added);
+        }
+    }
+    string placesAffected;
+    for (const string& place : places) {
+        if (!placesAffected.empty()) placesAffected += " | ";
+        placesAffected += place;
+    }
+    t.placesAffected = text.store(placesAffected);
+    parseTimestamps(t);
+    return t;
+}
+
+// Function to generate options.rows storms in order, handing each to sink(Typhoon&&). Their text
+// goes to text, which a streaming sink may clear after each record.
+template <typename Sink>
+void generateSyntheticArchive(const SyntheticArchiveOptions& options, const SyntheticProfile& profile,
+                              StringArena& text, Sink sink) {
+    mt19937_64 rng(options.seed);
+    for (size_t i = 0; i < options.rows; ++i) sink(makeSyntheticTyphoon(rng, options, profile, i + 1, text));
+}
+
+// Function to make a whole synthetic archive in memory, its text kept in text
+vector<Typhoon> makeSyntheticArchive(const SyntheticArchiveOptions& options, const SyntheticProfile& profile,
+                                     StringArena& text) {
+    vector<Typhoon> typhoons;
+    typhoons.reserve(options.rows);
+    generateSyntheticArchive(options, profile, text, [&](Typhoon&& t) { typhoons.push_back(move(t)); });
+    return typhoons;
+}
+
+// Function to write one CSV field, quoting it when it holds a comma or quote
+void writeCsvField(ostream& out, string_view field) {
+    if (field.find_first_of(",\"") == string_view::npos) {
+        out << field;
+        return;
+    }
+    out << '"';
+    for (char c : field) {
+        if (c == '"') out << '"';
+        out << c;
+    }
+    out << '"';
+}
+
+// Function to write the typhoons.csv header row
+void writeArchiveHeader(ostream& out) {
+    out << "year,name,arrival,departure,month,interval,stormCrossing,timeOfLandfall,developed,pathType,"
+           "levels,windSpeed,casualties,damages,placesAffected\n";
+}
+
+// Function to write one record as a typhoons.csv row
+void writeArchiveRow(ostream& out, const Typhoon& t) {
+    out << t.year << ',';
+    for (const string_view* field : {&t.name, &t.arrival, &t.departure, &t.month, &t.interval, &t.stormCrossing,
+                                &t.timeOfLandfall, &t.developed, &t.pathType, &t.levels}) {
+        writeCsvField(out, *field);
+        out << ',';
+    }
+    char damages[64];
+    snprintf(damages, sizeof(damages), "%.2f", t.damages);
+    out << t.windSpeed << ',' << t.casualties << ',' << damages << ',';
+    writeCsvField(out, t.placesAffected);
+    out << '\n';
+}
+
+// Function to write records in the typhoons.csv layout; false if the file cannot be written
+bool writeArchiveCsv(const string& path, const vector<Typhoon>& typhoons) {
+    ofstream out(path, ios::binary);
+    if (!out) {
+        cout << "Error: Cannot write archive '" << path << "'." << endl;
+        return false;
+    }
+    writeArchiveHeader(out);
+    for (const Typhoon& t : typhoons) writeArchiveRow(out, t);
+    return static_cast<bool>(out);
+}
+
+#endif